@@ -0,0 +1,260 @@
+#include "MinesweeperBoard.h"
+#include "Math/RandomStream.h"
+
+namespace MinesweeperBoard
+{
+	// Progress is reported once per this many tiles so the atomic store stays off the hot path
+	constexpr int32 ProgressGranularity = 4096;
+
+	bool IsCancelled(const FMinesweeperGenerationControl* Control)
+	{
+		return Control && Control->bCancelRequested.load(std::memory_order_relaxed);
+	}
+
+	void SetProgress(FMinesweeperGenerationControl* Control, float Progress)
+	{
+		if (Control)
+		{
+			Control->Progress.store(Progress, std::memory_order_relaxed);
+		}
+	}
+}
+
+template <typename TopologyType>
+TMinesweeperBoard<TopologyType>::TMinesweeperBoard(int32 InWidth, int32 InHeight, int32 InDepth)
+	: Width(FMath::Max(InWidth, TopologyType::MinExtent))
+	, Height(FMath::Max(InHeight, TopologyType::MinExtent))
+	, Depth(TopologyType::NumDimensions == 3 ? FMath::Max(InDepth, TopologyType::MinExtent) : 1)
+	, BombCount(0)
+	, Status(EMinesweeperGameStatus::Playing)
+	, RevealedCount(0)
+	, FlagCount(0)
+{
+	Bombs.SetNumZeroed(GetNumTiles());
+	AdjacentBombs.SetNumZeroed(GetNumTiles());
+	CellStates.Init(EMinesweeperCellState::Hidden, GetNumTiles());
+}
+
+template <typename TopologyType>
+TSharedPtr<TMinesweeperBoard<TopologyType>> TMinesweeperBoard<TopologyType>::Generate(int32 InWidth, int32 InHeight, int32 InBombCount, int32 Seed, FMinesweeperGenerationControl* Control, int32 InDepth)
+{
+	TSharedPtr<TMinesweeperBoard> Board = MakeShared<TMinesweeperBoard>(InWidth, InHeight, InDepth);
+	if (!Board->Reinitialize(InBombCount, Seed, Control))
+	{
+		return nullptr;
+	}
+	return Board;
+}
+
+template <typename TopologyType>
+bool TMinesweeperBoard<TopologyType>::Reinitialize(int32 InBombCount, int32 Seed, FMinesweeperGenerationControl* Control)
+{
+	const int32 NumTiles = GetNumTiles();
+	BombCount = FMath::Clamp(InBombCount, 1, NumTiles - 1);
+
+	ResetPlayState();
+	FMemory::Memzero(Bombs.GetData(), Bombs.Num());
+
+	// The flood fill stack is idle until play starts, so it doubles as the shuffle buffer
+	TArray<int32>& Positions = FloodStack;
+	Positions.SetNumUninitialized(NumTiles, EAllowShrinking::No);
+	for (int32 Index = 0; Index < NumTiles; Index++)
+	{
+		Positions[Index] = Index;
+	}
+
+	// Partial Fisher-Yates: only the first BombCount slots need to be drawn
+	FRandomStream Random(Seed);
+	for (int32 i = 0; i < BombCount; i++)
+	{
+		if (i % MinesweeperBoard::ProgressGranularity == 0)
+		{
+			if (MinesweeperBoard::IsCancelled(Control))
+			{
+				return false;
+			}
+			MinesweeperBoard::SetProgress(Control, 0.5f * i / BombCount);
+		}
+
+		const int32 j = Random.RandRange(i, NumTiles - 1);
+		Positions.Swap(i, j);
+		Bombs[Positions[i]] = 1;
+	}
+	Positions.Reset();
+
+	ComputeAdjacency(Control);
+	if (MinesweeperBoard::IsCancelled(Control))
+	{
+		return false;
+	}
+
+	MinesweeperBoard::SetProgress(Control, 1.0f);
+	return true;
+}
+
+template <typename TopologyType>
+void TMinesweeperBoard<TopologyType>::ComputeAdjacency(FMinesweeperGenerationControl* Control)
+{
+	const FIntVector Extent = GetExtent();
+	const int32 NumRows = Height * Depth;
+
+	for (int32 Row = 0; Row < NumRows; Row++)
+	{
+		if (MinesweeperBoard::IsCancelled(Control))
+		{
+			return;
+		}
+		MinesweeperBoard::SetProgress(Control, 0.5f + 0.5f * Row / NumRows);
+
+		const int32 Y = Row % Height;
+		const int32 Z = Row / Height;
+		uint8* AdjacentRow = AdjacentBombs.GetData() + Row * Width;
+
+		for (int32 X = 0; X < Width; X++)
+		{
+			int32 Count = 0;
+			TopologyType::ForEachNeighbour(X, Y, Z, Extent, [this, &Count](int32 Neighbour)
+			{
+				Count += Bombs[Neighbour];
+			});
+			AdjacentRow[X] = static_cast<uint8>(Count);
+		}
+	}
+}
+
+template <typename TopologyType>
+EMinesweeperGameStatus TMinesweeperBoard<TopologyType>::RevealIndex(int32 Index, TArray<int32>* OutRevealed)
+{
+	if (Status != EMinesweeperGameStatus::Playing || !IsValidIndex(Index))
+	{
+		return Status;
+	}
+
+	if (CellStates[Index] != EMinesweeperCellState::Hidden)
+	{
+		return Status;
+	}
+
+	if (Bombs[Index])
+	{
+		CellStates[Index] = EMinesweeperCellState::Revealed;
+		if (OutRevealed)
+		{
+			OutRevealed->Add(Index);
+		}
+		Status = EMinesweeperGameStatus::Lost;
+		return Status;
+	}
+
+	FloodReveal(Index, OutRevealed);
+	return Status;
+}
+
+template <typename TopologyType>
+EMinesweeperGameStatus TMinesweeperBoard<TopologyType>::ChordIndex(int32 Index, TArray<int32>* OutRevealed)
+{
+	if (Status != EMinesweeperGameStatus::Playing || !IsValidIndex(Index))
+	{
+		return Status;
+	}
+
+	if (CellStates[Index] != EMinesweeperCellState::Revealed)
+	{
+		return Status;
+	}
+
+	int32 Flags = 0;
+	ForEachNeighbour(Index, [this, &Flags](int32 Neighbour)
+	{
+		Flags += CellStates[Neighbour] == EMinesweeperCellState::Flagged ? 1 : 0;
+	});
+
+	if (Flags != AdjacentBombs[Index])
+	{
+		return Status;
+	}
+
+	ForEachNeighbour(Index, [this, OutRevealed](int32 Neighbour)
+	{
+		RevealIndex(Neighbour, OutRevealed);
+	});
+	return Status;
+}
+
+template <typename TopologyType>
+bool TMinesweeperBoard<TopologyType>::ToggleFlagIndex(int32 Index)
+{
+	if (Status != EMinesweeperGameStatus::Playing || !IsValidIndex(Index))
+	{
+		return false;
+	}
+
+	EMinesweeperCellState& State = CellStates[Index];
+	if (State == EMinesweeperCellState::Hidden)
+	{
+		State = EMinesweeperCellState::Flagged;
+		FlagCount++;
+		return true;
+	}
+	if (State == EMinesweeperCellState::Flagged)
+	{
+		State = EMinesweeperCellState::Hidden;
+		FlagCount--;
+		return true;
+	}
+	return false;
+}
+
+template <typename TopologyType>
+void TMinesweeperBoard<TopologyType>::ResetPlayState()
+{
+	CellStates.Init(EMinesweeperCellState::Hidden, GetNumTiles());
+	Status = EMinesweeperGameStatus::Playing;
+	RevealedCount = 0;
+	FlagCount = 0;
+}
+
+template <typename TopologyType>
+void TMinesweeperBoard<TopologyType>::FloodReveal(int32 StartIndex, TArray<int32>* OutRevealed)
+{
+	// Tiles are marked revealed when pushed so each one enters the stack at most once
+	CellStates[StartIndex] = EMinesweeperCellState::Revealed;
+	FloodStack.Reset();
+	FloodStack.Add(StartIndex);
+
+	while (FloodStack.Num() > 0)
+	{
+		const int32 Index = FloodStack.Pop(EAllowShrinking::No);
+		RevealedCount++;
+		if (OutRevealed)
+		{
+			OutRevealed->Add(Index);
+		}
+
+		if (AdjacentBombs[Index] != 0)
+		{
+			continue;
+		}
+
+		// A zero tile has no bomb neighbours, so everything pushed here is safe
+		ForEachNeighbour(Index, [this](int32 Neighbour)
+		{
+			if (CellStates[Neighbour] == EMinesweeperCellState::Hidden)
+			{
+				CellStates[Neighbour] = EMinesweeperCellState::Revealed;
+				FloodStack.Add(Neighbour);
+			}
+		});
+	}
+
+	if (RevealedCount == GetNumTiles() - BombCount)
+	{
+		Status = EMinesweeperGameStatus::Won;
+	}
+}
+
+template class TMinesweeperBoard<FMinesweeperSquare8Topology>;
+template class TMinesweeperBoard<FMinesweeperSquare4Topology>;
+template class TMinesweeperBoard<FMinesweeperHex6Topology>;
+template class TMinesweeperBoard<FMinesweeperTorusTopology>;
+template class TMinesweeperBoard<FMinesweeperCube26Topology>;
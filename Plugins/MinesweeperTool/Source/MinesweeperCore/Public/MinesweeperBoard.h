@@ -0,0 +1,154 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MinesweeperTopology.h"
+#include <atomic>
+
+/**
+ * Shared between the Slate thread and a background generation task.
+ * The widget raises bCancelRequested, the task publishes Progress in [0, 1].
+ */
+struct FMinesweeperGenerationControl
+{
+	std::atomic<bool> bCancelRequested{false};
+	std::atomic<float> Progress{0.0f};
+};
+
+enum class EMinesweeperCellState : uint8
+{
+	Hidden,
+	Revealed,
+	Flagged
+};
+
+enum class EMinesweeperGameStatus : uint8
+{
+	Playing,
+	Won,
+	Lost
+};
+
+/**
+ * One game: bomb positions, the precomputed adjacent bomb count of every tile
+ * and the play state, all stored row-major (then layer by layer) in flat arrays.
+ * TopologyType decides which tiles are neighbours, see MinesweeperTopology.h.
+ * Has no Slate dependencies so it can be built and played on any thread,
+ * but a single board must only be mutated by one thread at a time.
+ */
+template <typename TopologyType>
+class TMinesweeperBoard
+{
+public:
+	using FTopology = TopologyType;
+
+	/** Depth is ignored by 2D topologies. Extents below the topology's minimum are raised to it */
+	TMinesweeperBoard(int32 InWidth, int32 InHeight, int32 InDepth = 1);
+
+	/**
+	 * Places BombCount bombs with a seeded partial shuffle and precomputes adjacency.
+	 * Safe to call off the game thread. Returns null if Control requested a cancel.
+	 * InDepth is passed on to the constructor, so only 3D topologies use it.
+	 */
+	static TSharedPtr<TMinesweeperBoard> Generate(int32 InWidth, int32 InHeight, int32 InBombCount, int32 Seed, FMinesweeperGenerationControl* Control = nullptr, int32 InDepth = 1);
+
+	/** Lays out a new game in place, reusing the existing allocations. Returns false if cancelled */
+	bool Reinitialize(int32 InBombCount, int32 Seed, FMinesweeperGenerationControl* Control = nullptr);
+
+	int32 GetWidth() const { return Width; }
+	int32 GetHeight() const { return Height; }
+	int32 GetDepth() const { return Depth; }
+	int32 GetBombCount() const { return BombCount; }
+	int32 GetNumTiles() const { return Width * Height * Depth; }
+
+	// Coordinate variants address the first layer, which is the whole board for 2D topologies
+	int32 ToIndex(int32 X, int32 Y) const { return Y * Width + X; }
+	int32 ToIndex(int32 X, int32 Y, int32 Z) const { return (Z * Height + Y) * Width + X; }
+	bool IsValidTile(int32 X, int32 Y) const { return X >= 0 && Y >= 0 && X < Width && Y < Height; }
+	bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < GetNumTiles(); }
+
+	bool IsBomb(int32 X, int32 Y) const { return Bombs[ToIndex(X, Y)] != 0; }
+	int32 GetAdjacentBombs(int32 X, int32 Y) const { return AdjacentBombs[ToIndex(X, Y)]; }
+
+	// Flat index variants for code that walks the board without coordinates
+	bool IsBomb(int32 Index) const { return Bombs[Index] != 0; }
+	int32 GetAdjacentBombs(int32 Index) const { return AdjacentBombs[Index]; }
+
+	// Play API. This is everything a player is allowed to see and do.
+
+	/**
+	 * Reveals a hidden tile and flood fills outwards from tiles with no adjacent bombs.
+	 * Flagged tiles are never revealed. Newly revealed indices are appended to OutRevealed.
+	 */
+	EMinesweeperGameStatus Reveal(int32 X, int32 Y, TArray<int32>* OutRevealed = nullptr) { return IsValidTile(X, Y) ? RevealIndex(ToIndex(X, Y), OutRevealed) : Status; }
+	EMinesweeperGameStatus RevealIndex(int32 Index, TArray<int32>* OutRevealed = nullptr);
+
+	/** Reveals the hidden neighbours of a revealed number once the matching amount of flags surrounds it */
+	EMinesweeperGameStatus Chord(int32 X, int32 Y, TArray<int32>* OutRevealed = nullptr) { return IsValidTile(X, Y) ? ChordIndex(ToIndex(X, Y), OutRevealed) : Status; }
+	EMinesweeperGameStatus ChordIndex(int32 Index, TArray<int32>* OutRevealed = nullptr);
+
+	/** Flags or unflags a hidden tile. Returns false if the tile cannot be flagged */
+	bool ToggleFlag(int32 X, int32 Y) { return IsValidTile(X, Y) && ToggleFlagIndex(ToIndex(X, Y)); }
+	bool ToggleFlagIndex(int32 Index);
+
+	/** Hides every tile again so the same layout can be replayed */
+	void ResetPlayState();
+
+	EMinesweeperGameStatus GetStatus() const { return Status; }
+	EMinesweeperCellState GetCellState(int32 Index) const { return CellStates[Index]; }
+	int32 GetRevealedCount() const { return RevealedCount; }
+	int32 GetFlagCount() const { return FlagCount; }
+
+	/** Heap memory held by the board's arrays */
+	SIZE_T GetAllocatedSize() const { return Bombs.GetAllocatedSize() + AdjacentBombs.GetAllocatedSize() + CellStates.GetAllocatedSize() + FloodStack.GetAllocatedSize(); }
+
+	/** Adjacent bomb count of a revealed tile, INDEX_NONE for tiles the player cannot see into */
+	int32 GetVisibleNumber(int32 Index) const { return CellStates[Index] == EMinesweeperCellState::Revealed ? AdjacentBombs[Index] : INDEX_NONE; }
+
+	/** Calls Visit(NeighbourIndex) for each neighbour of Index under the board's topology */
+	template <typename FunctorType>
+	FORCEINLINE void ForEachNeighbour(int32 Index, FunctorType&& Visit) const
+	{
+		const int32 X = Index % Width;
+		if constexpr (TopologyType::NumDimensions == 3)
+		{
+			const int32 Row = Index / Width;
+			TopologyType::ForEachNeighbour(X, Row % Height, Row / Height, GetExtent(), Visit);
+		}
+		else
+		{
+			TopologyType::ForEachNeighbour(X, Index / Width, 0, GetExtent(), Visit);
+		}
+	}
+
+private:
+	FIntVector GetExtent() const { return FIntVector(Width, Height, Depth); }
+
+	void ComputeAdjacency(FMinesweeperGenerationControl* Control);
+	void FloodReveal(int32 StartIndex, TArray<int32>* OutRevealed);
+
+	int32 Width;
+	int32 Height;
+	int32 Depth;
+	int32 BombCount;
+
+	TArray<uint8> Bombs;
+	TArray<uint8> AdjacentBombs;
+
+	TArray<EMinesweeperCellState> CellStates;
+	EMinesweeperGameStatus Status;
+	int32 RevealedCount;
+	int32 FlagCount;
+
+	// Reused between reveals so a flood fill does not allocate
+	TArray<int32> FloodStack;
+};
+
+// Instantiated once in MinesweeperBoard.cpp, add new topologies there as well
+extern template class MINESWEEPERCORE_API TMinesweeperBoard<FMinesweeperSquare8Topology>;
+extern template class MINESWEEPERCORE_API TMinesweeperBoard<FMinesweeperSquare4Topology>;
+extern template class MINESWEEPERCORE_API TMinesweeperBoard<FMinesweeperHex6Topology>;
+extern template class MINESWEEPERCORE_API TMinesweeperBoard<FMinesweeperTorusTopology>;
+extern template class MINESWEEPERCORE_API TMinesweeperBoard<FMinesweeperCube26Topology>;
+
+/** The classic square board everything in the tool plays on */
+using FMinesweeperBoard = TMinesweeperBoard<FMinesweeperSquare8Topology>;
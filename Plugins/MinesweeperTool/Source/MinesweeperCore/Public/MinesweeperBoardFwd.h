@@ -0,0 +1,10 @@
+#pragma once
+
+// Forward declarations for headers that only pass boards around, FMinesweeperBoard is an alias so it cannot be declared as a class
+
+template <typename TopologyType>
+class TMinesweeperBoard;
+
+struct FMinesweeperSquare8Topology;
+
+using FMinesweeperBoard = TMinesweeperBoard<FMinesweeperSquare8Topology>;
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Neighbourhood policies for TMinesweeperBoard. Each one supplies its neighbour
+ * offsets as constexpr tables plus the edge handling, and is picked at compile
+ * time, so the flood fill and adjacency loops inline straight into fixed-count
+ * loops over the table without any per-tile dispatch.
+ *
+ * A policy provides:
+ *  NumDimensions  2, or 3 for boards with a depth
+ *  MaxNeighbours  the largest adjacent bomb count a tile can have
+ *  MinExtent      smallest width/height/depth the neighbourhood is well defined for
+ *  ForEachNeighbour(X, Y, Z, Extent, Visit) calling Visit(NeighbourIndex)
+ */
+namespace MinesweeperTopology
+{
+	struct FOffset
+	{
+		int32 X;
+		int32 Y;
+		int32 Z;
+	};
+
+	/** Visits X,Y,Z + every offset that lands on the board, or wraps around it when bWrap is set */
+	template <bool bWrap, int32 NumOffsets, typename FunctorType>
+	FORCEINLINE void VisitOffsets(const FOffset (&Offsets)[NumOffsets], int32 X, int32 Y, int32 Z, const FIntVector& Extent, FunctorType&& Visit)
+	{
+		for (int32 OffsetIndex = 0; OffsetIndex < NumOffsets; OffsetIndex++)
+		{
+			int32 NX = X + Offsets[OffsetIndex].X;
+			int32 NY = Y + Offsets[OffsetIndex].Y;
+			int32 NZ = Z + Offsets[OffsetIndex].Z;
+
+			if constexpr (bWrap)
+			{
+				// Offsets never exceed one tile, so a single conditional add or subtract wraps
+				NX += NX < 0 ? Extent.X : (NX >= Extent.X ? -Extent.X : 0);
+				NY += NY < 0 ? Extent.Y : (NY >= Extent.Y ? -Extent.Y : 0);
+				NZ += NZ < 0 ? Extent.Z : (NZ >= Extent.Z ? -Extent.Z : 0);
+			}
+			else if (uint32(NX) >= uint32(Extent.X) || uint32(NY) >= uint32(Extent.Y) || uint32(NZ) >= uint32(Extent.Z))
+			{
+				continue;
+			}
+
+			Visit((NZ * Extent.Y + NY) * Extent.X + NX);
+		}
+	}
+}
+
+/** The classic board: the 8 surrounding tiles, clipped at the edges */
+struct FMinesweeperSquare8Topology
+{
+	static constexpr int32 NumDimensions = 2;
+	static constexpr int32 MaxNeighbours = 8;
+	static constexpr int32 MinExtent = 1;
+
+	// Row by row, so chords and flood fills visit tiles in reading order
+	static constexpr MinesweeperTopology::FOffset Offsets[] =
+	{
+		{-1, -1, 0}, {0, -1, 0}, {1, -1, 0},
+		{-1,  0, 0},             {1,  0, 0},
+		{-1,  1, 0}, {0,  1, 0}, {1,  1, 0}
+	};
+
+	template <typename FunctorType>
+	static FORCEINLINE void ForEachNeighbour(int32 X, int32 Y, int32 Z, const FIntVector& Extent, FunctorType&& Visit)
+	{
+		MinesweeperTopology::VisitOffsets<false>(Offsets, X, Y, Z, Extent, Visit);
+	}
+};
+
+/** Orthogonal neighbours only, diagonals do not count */
+struct FMinesweeperSquare4Topology
+{
+	static constexpr int32 NumDimensions = 2;
+	static constexpr int32 MaxNeighbours = 4;
+	static constexpr int32 MinExtent = 1;
+
+	static constexpr MinesweeperTopology::FOffset Offsets[] =
+	{
+		{0, -1, 0}, {-1, 0, 0}, {1, 0, 0}, {0, 1, 0}
+	};
+
+	template <typename FunctorType>
+	static FORCEINLINE void ForEachNeighbour(int32 X, int32 Y, int32 Z, const FIntVector& Extent, FunctorType&& Visit)
+	{
+		MinesweeperTopology::VisitOffsets<false>(Offsets, X, Y, Z, Extent, Visit);
+	}
+};
+
+/** Pointy-top hexagons in "odd-r" offset layout: odd rows are shifted half a tile to the right */
+struct FMinesweeperHex6Topology
+{
+	static constexpr int32 NumDimensions = 2;
+	static constexpr int32 MaxNeighbours = 6;
+	static constexpr int32 MinExtent = 1;
+
+	static constexpr MinesweeperTopology::FOffset EvenRowOffsets[] =
+	{
+		{-1, -1, 0}, {0, -1, 0},
+		{-1,  0, 0}, {1,  0, 0},
+		{-1,  1, 0}, {0,  1, 0}
+	};
+
+	static constexpr MinesweeperTopology::FOffset OddRowOffsets[] =
+	{
+		{0, -1, 0}, {1, -1, 0},
+		{-1, 0, 0}, {1,  0, 0},
+		{0,  1, 0}, {1,  1, 0}
+	};
+
+	template <typename FunctorType>
+	static FORCEINLINE void ForEachNeighbour(int32 X, int32 Y, int32 Z, const FIntVector& Extent, FunctorType&& Visit)
+	{
+		MinesweeperTopology::VisitOffsets<false>((Y & 1) ? OddRowOffsets : EvenRowOffsets, X, Y, Z, Extent, Visit);
+	}
+};
+
+/** 8 neighbours with the edges wrapped around, so every tile has a full neighbourhood */
+struct FMinesweeperTorusTopology
+{
+	static constexpr int32 NumDimensions = 2;
+	static constexpr int32 MaxNeighbours = 8;
+
+	// Below 3 tiles a wrapped neighbour would be the tile itself or be visited twice
+	static constexpr int32 MinExtent = 3;
+
+	template <typename FunctorType>
+	static FORCEINLINE void ForEachNeighbour(int32 X, int32 Y, int32 Z, const FIntVector& Extent, FunctorType&& Visit)
+	{
+		MinesweeperTopology::VisitOffsets<true>(FMinesweeperSquare8Topology::Offsets, X, Y, Z, Extent, Visit);
+	}
+};
+
+/** A stack of layers where each cell touches the 26 cells of the surrounding cube */
+struct FMinesweeperCube26Topology
+{
+	static constexpr int32 NumDimensions = 3;
+	static constexpr int32 MaxNeighbours = 26;
+	static constexpr int32 MinExtent = 1;
+
+	static constexpr MinesweeperTopology::FOffset Offsets[] =
+	{
+		{-1, -1, -1}, {0, -1, -1}, {1, -1, -1},
+		{-1,  0, -1}, {0,  0, -1}, {1,  0, -1},
+		{-1,  1, -1}, {0,  1, -1}, {1,  1, -1},
+
+		{-1, -1,  0}, {0, -1,  0}, {1, -1,  0},
+		{-1,  0,  0},              {1,  0,  0},
+		{-1,  1,  0}, {0,  1,  0}, {1,  1,  0},
+
+		{-1, -1,  1}, {0, -1,  1}, {1, -1,  1},
+		{-1,  0,  1}, {0,  0,  1}, {1,  0,  1},
+		{-1,  1,  1}, {0,  1,  1}, {1,  1,  1}
+	};
+
+	template <typename FunctorType>
+	static FORCEINLINE void ForEachNeighbour(int32 X, int32 Y, int32 Z, const FIntVector& Extent, FunctorType&& Visit)
+	{
+		MinesweeperTopology::VisitOffsets<false>(Offsets, X, Y, Z, Extent, Visit);
+	}
+};
@@ -40,6 +40,7 @@ public class MinesweeperTool : ModuleRules
 				"UnrealEd",
 				"ToolMenus",
 				"UnrealMCP",
+				"MinesweeperCore",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -0,0 +1,233 @@
+#include "MinesweeperAnalyzer.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+
+#define LOCTEXT_NAMESPACE "MinesweeperAnalyzer"
+
+namespace MinesweeperAnalyzerColumns
+{
+	static const FName Seed("Seed");
+	static const FName ThreeBV("ThreeBV");
+	static const FName Openings("Openings");
+	static const FName IsolatedNumbers("IsolatedNumbers");
+	static const FName Guesses("Guesses");
+
+	int32 GetValue(const FMinesweeperBoardStats& Stats, FName ColumnId)
+	{
+		if (ColumnId == ThreeBV) return Stats.ThreeBV;
+		if (ColumnId == Openings) return Stats.Openings;
+		if (ColumnId == IsolatedNumbers) return Stats.IsolatedNumbers;
+		if (ColumnId == Guesses) return Stats.Guesses;
+		return Stats.Seed;
+	}
+}
+
+class SMinesweeperAnalyzerRow : public SMultiColumnTableRow<TSharedPtr<FMinesweeperBoardStats>>
+{
+public:
+	SLATE_BEGIN_ARGS(SMinesweeperAnalyzerRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FMinesweeperBoardStats>, Stats)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable)
+	{
+		Stats = InArgs._Stats;
+		SMultiColumnTableRow<TSharedPtr<FMinesweeperBoardStats>>::Construct(FSuperRowType::FArguments(), OwnerTable);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+	{
+		return SNew(STextBlock)
+			.Text(FText::AsNumber(MinesweeperAnalyzerColumns::GetValue(*Stats, ColumnName), &FNumberFormattingOptions::DefaultNoGrouping()));
+	}
+
+private:
+	TSharedPtr<FMinesweeperBoardStats> Stats;
+};
+
+void SMinesweeperAnalyzer::Construct(const FArguments& InArgs)
+{
+	auto MakeLabeledInput = [](const FText& Label, TSharedPtr<SEditableTextBox>& OutInput, int32 DefaultValue)
+	{
+		return SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(5)
+			[
+				SNew(STextBlock)
+				.Text(Label)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(5)
+			[
+				SAssignNew(OutInput, SEditableTextBox)
+				.MinDesiredWidth(60)
+				.Text(FText::FromString(FString::FromInt(DefaultValue)))
+			];
+	};
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(5)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot().AutoWidth()[ MakeLabeledInput(LOCTEXT("WidthLabel", "Width:"), WidthInput, 30) ]
+			+ SHorizontalBox::Slot().AutoWidth()[ MakeLabeledInput(LOCTEXT("HeightLabel", "Height:"), HeightInput, 16) ]
+			+ SHorizontalBox::Slot().AutoWidth()[ MakeLabeledInput(LOCTEXT("BombsLabel", "Bombs:"), BombCountInput, 99) ]
+			+ SHorizontalBox::Slot().AutoWidth()[ MakeLabeledInput(LOCTEXT("FirstSeedLabel", "First seed:"), FirstSeedInput, 0) ]
+			+ SHorizontalBox::Slot().AutoWidth()[ MakeLabeledInput(LOCTEXT("SeedCountLabel", "Seeds:"), SeedCountInput, 1000) ]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(5)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("Analyze", "Analyze"))
+				.IsEnabled_Lambda([this]() { return !PendingResults.IsValid(); })
+				.OnClicked_Lambda([this]()
+				{
+					StartAnalysis();
+					return FReply::Handled();
+				})
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(5)
+		[
+			SAssignNew(StatusText, STextBlock)
+			.Text(LOCTEXT("StatusIdle", "Pick a board configuration and a seed range to analyze"))
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		.Padding(5)
+		[
+			SAssignNew(ListView, SListView<FStatsPtr>)
+			.ListItemsSource(&Rows)
+			.OnGenerateRow(this, &SMinesweeperAnalyzer::OnGenerateRow)
+			.SelectionMode(ESelectionMode::Multi)
+			.HeaderRow
+			(
+				SNew(SHeaderRow)
+				+ SHeaderRow::Column(MinesweeperAnalyzerColumns::Seed)
+				.DefaultLabel(LOCTEXT("SeedColumn", "Seed"))
+				.SortMode(this, &SMinesweeperAnalyzer::GetColumnSortMode, MinesweeperAnalyzerColumns::Seed)
+				.OnSort(this, &SMinesweeperAnalyzer::OnSortColumn)
+				+ SHeaderRow::Column(MinesweeperAnalyzerColumns::ThreeBV)
+				.DefaultLabel(LOCTEXT("ThreeBVColumn", "3BV"))
+				.SortMode(this, &SMinesweeperAnalyzer::GetColumnSortMode, MinesweeperAnalyzerColumns::ThreeBV)
+				.OnSort(this, &SMinesweeperAnalyzer::OnSortColumn)
+				+ SHeaderRow::Column(MinesweeperAnalyzerColumns::Openings)
+				.DefaultLabel(LOCTEXT("OpeningsColumn", "Openings"))
+				.SortMode(this, &SMinesweeperAnalyzer::GetColumnSortMode, MinesweeperAnalyzerColumns::Openings)
+				.OnSort(this, &SMinesweeperAnalyzer::OnSortColumn)
+				+ SHeaderRow::Column(MinesweeperAnalyzerColumns::IsolatedNumbers)
+				.DefaultLabel(LOCTEXT("IsolatedColumn", "Isolated Numbers"))
+				.SortMode(this, &SMinesweeperAnalyzer::GetColumnSortMode, MinesweeperAnalyzerColumns::IsolatedNumbers)
+				.OnSort(this, &SMinesweeperAnalyzer::OnSortColumn)
+				+ SHeaderRow::Column(MinesweeperAnalyzerColumns::Guesses)
+				.DefaultLabel(LOCTEXT("GuessesColumn", "Guesses"))
+				.SortMode(this, &SMinesweeperAnalyzer::GetColumnSortMode, MinesweeperAnalyzerColumns::Guesses)
+				.OnSort(this, &SMinesweeperAnalyzer::OnSortColumn)
+			)
+		]
+	];
+}
+
+void SMinesweeperAnalyzer::StartAnalysis()
+{
+	const int32 Width = FMath::Clamp(FCString::Atoi(*WidthInput->GetText().ToString()), 5, 30);
+	const int32 Height = FMath::Clamp(FCString::Atoi(*HeightInput->GetText().ToString()), 5, 30);
+	const int32 BombCount = FMath::Clamp(FCString::Atoi(*BombCountInput->GetText().ToString()), 1, Width * Height - 1);
+	const int32 FirstSeed = FCString::Atoi(*FirstSeedInput->GetText().ToString());
+	const int32 NumSeeds = FMath::Clamp(FCString::Atoi(*SeedCountInput->GetText().ToString()), 1, 1000000);
+
+	WidthInput->SetText(FText::FromString(FString::FromInt(Width)));
+	HeightInput->SetText(FText::FromString(FString::FromInt(Height)));
+	BombCountInput->SetText(FText::FromString(FString::FromInt(BombCount)));
+	SeedCountInput->SetText(FText::FromString(FString::FromInt(NumSeeds)));
+
+	StatusText->SetText(FText::Format(LOCTEXT("StatusRunning", "Analyzing {0} seeds..."), NumSeeds));
+	AnalysisStartTime = FPlatformTime::Seconds();
+
+	// ParallelFor inside fans the seeds out over the task graph workers
+	PendingResults = Async(EAsyncExecution::ThreadPool, [Width, Height, BombCount, FirstSeed, NumSeeds]()
+	{
+		TArray<FMinesweeperBoardStats> Stats;
+		FMinesweeperBoardAnalyzer::AnalyzeSeeds(Width, Height, BombCount, FirstSeed, NumSeeds, Stats);
+		return Stats;
+	});
+}
+
+void SMinesweeperAnalyzer::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	if (!PendingResults.IsValid() || !PendingResults.IsReady())
+	{
+		return;
+	}
+
+	TArray<FMinesweeperBoardStats> Results = PendingResults.Get();
+	PendingResults.Reset();
+
+	Rows.Reset(Results.Num());
+	for (const FMinesweeperBoardStats& Stats : Results)
+	{
+		Rows.Add(MakeShared<FMinesweeperBoardStats>(Stats));
+	}
+	SortRows();
+
+	StatusText->SetText(FText::Format(LOCTEXT("StatusDone", "Analyzed {0} seeds in {1} s"),
+		Results.Num(), FText::AsNumber(FPlatformTime::Seconds() - AnalysisStartTime)));
+}
+
+TSharedRef<ITableRow> SMinesweeperAnalyzer::OnGenerateRow(FStatsPtr Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SMinesweeperAnalyzerRow, OwnerTable)
+		.Stats(Item);
+}
+
+EColumnSortMode::Type SMinesweeperAnalyzer::GetColumnSortMode(FName ColumnId) const
+{
+	return ColumnId == SortColumn ? SortMode : EColumnSortMode::None;
+}
+
+void SMinesweeperAnalyzer::OnSortColumn(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type NewSortMode)
+{
+	SortColumn = ColumnId;
+	SortMode = NewSortMode;
+	SortRows();
+}
+
+void SMinesweeperAnalyzer::SortRows()
+{
+	if (SortMode != EColumnSortMode::None)
+	{
+		const bool bAscending = SortMode == EColumnSortMode::Ascending;
+		const FName Column = SortColumn;
+
+		// Stable so that ties keep seed order
+		Rows.StableSort([bAscending, Column](const FStatsPtr& A, const FStatsPtr& B)
+		{
+			const int32 ValueA = MinesweeperAnalyzerColumns::GetValue(*A, Column);
+			const int32 ValueB = MinesweeperAnalyzerColumns::GetValue(*B, Column);
+			return bAscending ? ValueA < ValueB : ValueA > ValueB;
+		});
+	}
+
+	ListView->RequestListRefresh();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,193 @@
+#include "MinesweeperBoardAnalyzer.h"
+#include "MinesweeperBoard.h"
+#include "MinesweeperSolver.h"
+#include "Async/ParallelFor.h"
+
+namespace MinesweeperAnalyzer
+{
+	int32 FindRoot(TArray<int32>& Parent, int32 Index)
+	{
+		// Path halving keeps the trees flat without a second pass
+		while (Parent[Index] != Index)
+		{
+			Parent[Index] = Parent[Parent[Index]];
+			Index = Parent[Index];
+		}
+		return Index;
+	}
+
+	void Union(TArray<int32>& Parent, int32 A, int32 B)
+	{
+		const int32 RootA = FindRoot(Parent, A);
+		const int32 RootB = FindRoot(Parent, B);
+		if (RootA != RootB)
+		{
+			// Lower index wins so the root of an opening is its first tile in scan order
+			Parent[FMath::Max(RootA, RootB)] = FMath::Min(RootA, RootB);
+		}
+	}
+}
+
+FMinesweeperBoardStats FMinesweeperBoardAnalyzer::Analyze(const FMinesweeperBoard& Board, int32 Seed)
+{
+	FMinesweeperBoardStats Stats;
+	Stats.Seed = Seed;
+
+	const int32 Width = Board.GetWidth();
+	const int32 Height = Board.GetHeight();
+	const int32 NumTiles = Board.GetNumTiles();
+
+	auto IsOpeningTile = [&Board](int32 Index)
+	{
+		return !Board.IsBomb(Index) && Board.GetAdjacentBombs(Index) == 0;
+	};
+
+	// Two-pass labelling: only the already visited W, NW, N and NE neighbours need a union
+	TArray<int32> Parent;
+	Parent.Init(INDEX_NONE, NumTiles);
+	for (int32 Y = 0; Y < Height; Y++)
+	{
+		for (int32 X = 0; X < Width; X++)
+		{
+			const int32 Index = Board.ToIndex(X, Y);
+			if (!IsOpeningTile(Index))
+			{
+				continue;
+			}
+
+			Parent[Index] = Index;
+
+			const FIntPoint Previous[] = { {X - 1, Y}, {X - 1, Y - 1}, {X, Y - 1}, {X + 1, Y - 1} };
+			for (const FIntPoint& Other : Previous)
+			{
+				if (Board.IsValidTile(Other.X, Other.Y) && Parent[Board.ToIndex(Other.X, Other.Y)] != INDEX_NONE)
+				{
+					MinesweeperAnalyzer::Union(Parent, Index, Board.ToIndex(Other.X, Other.Y));
+				}
+			}
+		}
+	}
+
+	int32 FirstClick = INDEX_NONE;
+	for (int32 Index = 0; Index < NumTiles; Index++)
+	{
+		if (Parent[Index] == INDEX_NONE)
+		{
+			if (!Board.IsBomb(Index))
+			{
+				// A number is cleared by an opening only if it touches one
+				bool bTouchesOpening = false;
+				Board.ForEachNeighbour(Index, [&Parent, &bTouchesOpening](int32 Neighbour)
+				{
+					bTouchesOpening |= Parent[Neighbour] != INDEX_NONE;
+				});
+				Stats.IsolatedNumbers += bTouchesOpening ? 0 : 1;
+			}
+		}
+		else if (MinesweeperAnalyzer::FindRoot(Parent, Index) == Index)
+		{
+			Stats.Openings++;
+			if (FirstClick == INDEX_NONE)
+			{
+				FirstClick = Index;
+			}
+		}
+	}
+
+	Stats.ThreeBV = Stats.Openings + Stats.IsolatedNumbers;
+
+	// Without any opening the player has to start on a number
+	if (FirstClick == INDEX_NONE)
+	{
+		for (int32 Index = 0; Index < NumTiles && FirstClick == INDEX_NONE; Index++)
+		{
+			FirstClick = Board.IsBomb(Index) ? INDEX_NONE : Index;
+		}
+	}
+
+	Stats.FirstClick = FirstClick;
+	Stats.Guesses = CountSolverGuesses(Board, FirstClick);
+	return Stats;
+}
+
+int32 FMinesweeperBoardAnalyzer::CountSolverGuesses(const FMinesweeperBoard& Board, int32 FirstClick)
+{
+	FMinesweeperSolver Solver(Board.GetWidth(), Board.GetHeight());
+
+	const int32 NumTiles = Board.GetNumTiles();
+	const int32 SafeTiles = NumTiles - Board.GetBombCount();
+	int32 Revealed = 0;
+
+	TArray<int32> Stack;
+	auto Reveal = [&Board, &Solver, &Stack, &Revealed](int32 Start)
+	{
+		Stack.Add(Start);
+		while (Stack.Num() > 0)
+		{
+			const int32 Index = Stack.Pop(EAllowShrinking::No);
+			if (Solver.GetKnowledge(Index) == FMinesweeperSolver::EKnowledge::Revealed)
+			{
+				continue;
+			}
+
+			Solver.OnRevealed(Index, Board.GetAdjacentBombs(Index));
+			Revealed++;
+
+			if (Board.GetAdjacentBombs(Index) == 0)
+			{
+				Board.ForEachNeighbour(Index, [&Solver, &Stack](int32 Neighbour)
+				{
+					if (Solver.GetKnowledge(Neighbour) != FMinesweeperSolver::EKnowledge::Revealed)
+					{
+						Stack.Add(Neighbour);
+					}
+				});
+			}
+		}
+	};
+
+	Reveal(FirstClick);
+
+	// Tiles behind the cursor are bombs or revealed and stay that way, so the guess scan is linear overall
+	int32 GuessCursor = 0;
+	int32 Guesses = 0;
+	TArray<int32> Safe;
+
+	while (Revealed < SafeTiles)
+	{
+		Safe.Reset();
+		Solver.Deduce(Safe);
+
+		if (Safe.Num() == 0)
+		{
+			// Stuck: the analyser knows the answer, so the guess is always a safe tile
+			while (Board.IsBomb(GuessCursor) || Solver.GetKnowledge(GuessCursor) == FMinesweeperSolver::EKnowledge::Revealed)
+			{
+				GuessCursor++;
+			}
+			Guesses++;
+			Reveal(GuessCursor);
+			continue;
+		}
+
+		for (int32 Index : Safe)
+		{
+			Reveal(Index);
+		}
+	}
+
+	return Guesses;
+}
+
+void FMinesweeperBoardAnalyzer::AnalyzeSeeds(int32 Width, int32 Height, int32 BombCount, int32 FirstSeed, int32 NumSeeds, TArray<FMinesweeperBoardStats>& OutStats)
+{
+	OutStats.SetNum(NumSeeds);
+
+	ParallelFor(NumSeeds, [&OutStats, Width, Height, BombCount, FirstSeed](int32 SeedOffset)
+	{
+		// Wrapped rather than overflowed when the range runs past MAX_int32
+		const int32 Seed = int32(uint32(FirstSeed) + uint32(SeedOffset));
+		TSharedPtr<FMinesweeperBoard> Board = FMinesweeperBoard::Generate(Width, Height, BombCount, Seed);
+		OutStats[SeedOffset] = Analyze(*Board, Seed);
+	});
+}
@@ -0,0 +1,362 @@
+#include "MinesweeperBoardCache.h"
+#include "MinesweeperBoardAnalyzer.h"
+#include "MinesweeperTelemetry.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/CompactBinary.h"
+#include "Serialization/CompactBinaryValidation.h"
+#include "Serialization/CompactBinaryWriter.h"
+
+namespace MinesweeperBoardCache
+{
+	// Bump whenever generation or the solver changes, stored seeds would no longer describe the same boards
+	constexpr int32 FormatVersion = 1;
+
+	// Beginner, intermediate and expert, the configurations worth having ready before anyone asks
+	const FMinesweeperBoardCacheKey Presets[] =
+	{
+		{ 9, 9, 10, EMinesweeperBoardMode::NoGuess },
+		{ 16, 16, 40, EMinesweeperBoardMode::NoGuess },
+		{ 30, 16, 99, EMinesweeperBoardMode::NoGuess }
+	};
+
+	bool IsCancelled(const FMinesweeperGenerationControl* Control)
+	{
+		return Control && Control->bCancelRequested.load(std::memory_order_relaxed);
+	}
+}
+
+FMinesweeperBoardCache::FMinesweeperBoardCache(const FString& InFilePath)
+	: FilePath(InFilePath)
+	, SeedSource(FPlatformTime::Cycles())
+{
+	FScopeLock ScopeLock(&Lock);
+
+	// Presets first so the configurations from the last session end up more recently used
+	for (const FMinesweeperBoardCacheKey& Key : MinesweeperBoardCache::Presets)
+	{
+		TouchPool(Key);
+	}
+	Load();
+
+	KickRefill();
+}
+
+FMinesweeperBoardCache::~FMinesweeperBoardCache()
+{
+	RefillControl.bCancelRequested.store(true, std::memory_order_relaxed);
+	if (RefillTask.IsValid())
+	{
+		RefillTask.Wait();
+	}
+
+	Save();
+}
+
+bool FMinesweeperBoardCache::Take(const FMinesweeperBoardCacheKey& Key, FMinesweeperCachedBoard& OutBoard)
+{
+	if (!IsValidKey(Key))
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+
+	FPool& Pool = TouchPool(Key);
+	const bool bFound = Pool.Boards.Num() > 0;
+	if (bFound)
+	{
+		OutBoard = Pool.Boards.Pop(EAllowShrinking::No);
+	}
+
+	KickRefill();
+	return bFound;
+}
+
+void FMinesweeperBoardCache::Prewarm(const FMinesweeperBoardCacheKey& Key)
+{
+	if (!IsValidKey(Key))
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	TouchPool(Key);
+	KickRefill();
+}
+
+int32 FMinesweeperBoardCache::GetNumReady(const FMinesweeperBoardCacheKey& Key) const
+{
+	FScopeLock ScopeLock(&Lock);
+	const FPool* Pool = Pools.FindByPredicate([&Key](const FPool& Candidate) { return Candidate.Key == Key; });
+	return Pool ? Pool->Boards.Num() : 0;
+}
+
+bool FMinesweeperBoardCache::IsValidKey(const FMinesweeperBoardCacheKey& Key)
+{
+	if (Key.Mode != EMinesweeperBoardMode::NoGuess)
+	{
+		return false;
+	}
+
+	// Sides are checked first, so the tile count below cannot overflow
+	if (Key.Width < MinBoardSize || Key.Height < MinBoardSize || Key.Width > MaxBoardSize || Key.Height > MaxBoardSize)
+	{
+		return false;
+	}
+	return Key.BombCount > 0 && int64(Key.BombCount) < int64(Key.Width) * Key.Height;
+}
+
+FMinesweeperGeneratedBoard FMinesweeperBoardCache::Generate(const FMinesweeperBoardCacheKey& Key, int32 FirstSeed, FMinesweeperGenerationControl* Control, FMinesweeperCachedBoard* OutCached)
+{
+	FMinesweeperGeneratedBoard Result;
+
+	if (Key.Mode == EMinesweeperBoardMode::Random)
+	{
+		Result.Board = FMinesweeperBoard::Generate(Key.Width, Key.Height, Key.BombCount, FirstSeed, Control);
+		if (OutCached && Result.Board.IsValid())
+		{
+			OutCached->Seed = FirstSeed;
+			OutCached->StartIndex = INDEX_NONE;
+		}
+		return Result;
+	}
+
+	// One board is laid out again for every attempt, so the search does not allocate
+	TSharedPtr<FMinesweeperBoard> Candidate = MakeShared<FMinesweeperBoard>(Key.Width, Key.Height);
+	for (int32 Attempt = 0; Attempt < MaxNoGuessAttempts; Attempt++)
+	{
+		if (MinesweeperBoardCache::IsCancelled(Control))
+		{
+			return Result;
+		}
+
+		// Wraps instead of overflowing when FirstSeed is near the top of the range
+		const int32 Seed = int32(uint32(FirstSeed) + uint32(Attempt));
+		Candidate->Reinitialize(Key.BombCount, Seed);
+
+		const FMinesweeperBoardStats Stats = FMinesweeperBoardAnalyzer::Analyze(*Candidate, Seed);
+		if (Stats.Guesses == 0)
+		{
+			Result.Board = Candidate;
+			Result.StartIndex = Stats.FirstClick;
+			if (OutCached)
+			{
+				OutCached->Seed = Seed;
+				OutCached->StartIndex = Stats.FirstClick;
+			}
+			return Result;
+		}
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("No guess-free %dx%d board with %d bombs in %d seeds"), Key.Width, Key.Height, Key.BombCount, MaxNoGuessAttempts);
+	return Result;
+}
+
+FMinesweeperGeneratedBoard FMinesweeperBoardCache::Rebuild(const FMinesweeperBoardCacheKey& Key, const FMinesweeperCachedBoard& Cached, FMinesweeperGenerationControl* Control)
+{
+	FMinesweeperGeneratedBoard Result;
+	FMinesweeperTelemetryScope GenerateScope(EMinesweeperTelemetryEvent::Generate, Key.Width * Key.Height);
+	Result.Board = FMinesweeperBoard::Generate(Key.Width, Key.Height, Key.BombCount, Cached.Seed, Control);
+	if (!Result.Board.IsValid())
+	{
+		return Result;
+	}
+
+	// A start tile that is out of range or on a bomb means the file is damaged, let the player pick instead
+	if (Result.Board->IsValidIndex(Cached.StartIndex) && !Result.Board->IsBomb(Cached.StartIndex))
+	{
+		Result.StartIndex = Cached.StartIndex;
+	}
+	return Result;
+}
+
+FMinesweeperBoardCache::FPool& FMinesweeperBoardCache::TouchPool(const FMinesweeperBoardCacheKey& Key)
+{
+	const int32 PoolIndex = Pools.IndexOfByPredicate([&Key](const FPool& Candidate) { return Candidate.Key == Key; });
+	if (PoolIndex == INDEX_NONE)
+	{
+		if (Pools.Num() >= MaxKeys)
+		{
+			Pools.RemoveAt(0);
+		}
+
+		FPool& Pool = Pools.AddDefaulted_GetRef();
+		Pool.Key = Key;
+		return Pool;
+	}
+
+	if (PoolIndex != Pools.Num() - 1)
+	{
+		FPool Pool = MoveTemp(Pools[PoolIndex]);
+		Pools.RemoveAt(PoolIndex);
+		Pools.Add(MoveTemp(Pool));
+	}
+	return Pools.Last();
+}
+
+void FMinesweeperBoardCache::KickRefill()
+{
+	if (bRefilling || MinesweeperBoardCache::IsCancelled(&RefillControl))
+	{
+		return;
+	}
+
+	bRefilling = true;
+	RefillTask = Async(EAsyncExecution::ThreadPool, [this]()
+	{
+		Refill();
+	});
+}
+
+void FMinesweeperBoardCache::Refill()
+{
+	for (;;)
+	{
+		FMinesweeperBoardCacheKey Key;
+		int32 Seed = 0;
+		{
+			FScopeLock ScopeLock(&Lock);
+
+			// Most recently used configurations are topped up first
+			const FPool* Hungry = nullptr;
+			for (int32 PoolIndex = Pools.Num() - 1; PoolIndex >= 0 && !Hungry; PoolIndex--)
+			{
+				Hungry = Pools[PoolIndex].Boards.Num() < BoardsPerKey ? &Pools[PoolIndex] : nullptr;
+			}
+
+			if (!Hungry || MinesweeperBoardCache::IsCancelled(&RefillControl))
+			{
+				bRefilling = false;
+				return;
+			}
+
+			Key = Hungry->Key;
+			Seed = SeedSource.RandHelper(MAX_int32);
+		}
+
+		// The search runs unlocked, Take keeps working while an expert board is being found
+		FMinesweeperCachedBoard Cached;
+		const bool bGenerated = Generate(Key, Seed, &RefillControl, &Cached).Board.IsValid();
+
+		FScopeLock ScopeLock(&Lock);
+		const int32 PoolIndex = Pools.IndexOfByPredicate([&Key](const FPool& Candidate) { return Candidate.Key == Key; });
+		if (PoolIndex == INDEX_NONE)
+		{
+			// Evicted while the board was generated
+			continue;
+		}
+
+		if (bGenerated)
+		{
+			if (Pools[PoolIndex].Boards.Num() < BoardsPerKey)
+			{
+				Pools[PoolIndex].Boards.Add(Cached);
+			}
+		}
+		else if (!MinesweeperBoardCache::IsCancelled(&RefillControl))
+		{
+			// Too dense to ever be guess-free, drop it rather than search again forever
+			Pools.RemoveAt(PoolIndex);
+		}
+	}
+}
+
+bool FMinesweeperBoardCache::Save() const
+{
+	FCbWriter Writer;
+	Writer.BeginObject();
+	Writer.AddInteger(UTF8TEXTVIEW("Version"), MinesweeperBoardCache::FormatVersion);
+	Writer.BeginArray(UTF8TEXTVIEW("Pools"));
+	{
+		FScopeLock ScopeLock(&Lock);
+		for (const FPool& Pool : Pools)
+		{
+			Writer.BeginObject();
+			Writer.AddInteger(UTF8TEXTVIEW("Width"), Pool.Key.Width);
+			Writer.AddInteger(UTF8TEXTVIEW("Height"), Pool.Key.Height);
+			Writer.AddInteger(UTF8TEXTVIEW("Bombs"), Pool.Key.BombCount);
+			Writer.AddInteger(UTF8TEXTVIEW("Mode"), int32(Pool.Key.Mode));
+			Writer.BeginArray(UTF8TEXTVIEW("Boards"));
+			for (const FMinesweeperCachedBoard& Board : Pool.Boards)
+			{
+				// Seed and start tile packed in pairs, compact binary stores small integers in one or two bytes
+				Writer.AddInteger(Board.Seed);
+				Writer.AddInteger(Board.StartIndex);
+			}
+			Writer.EndArray();
+			Writer.EndObject();
+		}
+	}
+	Writer.EndArray();
+	Writer.EndObject();
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(Writer.GetSaveSize());
+	Writer.Save(MakeMemoryView(Buffer));
+
+	if (!FFileHelper::SaveArrayToFile(Buffer, *FilePath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Could not write the board cache to %s"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+bool FMinesweeperBoardCache::Load()
+{
+	TArray<uint8> Buffer;
+	if (!FFileHelper::LoadFileToArray(Buffer, *FilePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	if (ValidateCompactBinary(MakeMemoryView(Buffer), ECbValidateMode::Default) != ECbValidateError::None)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Ignoring damaged board cache %s"), *FilePath);
+		return false;
+	}
+
+	const FCbObjectView Root = FCbFieldView(Buffer.GetData()).AsObjectView();
+	if (Root[UTF8TEXTVIEW("Version")].AsInt32() != MinesweeperBoardCache::FormatVersion)
+	{
+		return false;
+	}
+
+	for (FCbFieldView PoolField : Root[UTF8TEXTVIEW("Pools")].AsArrayView())
+	{
+		const FCbObjectView PoolObject = PoolField.AsObjectView();
+
+		FMinesweeperBoardCacheKey Key;
+		Key.Width = PoolObject[UTF8TEXTVIEW("Width")].AsInt32();
+		Key.Height = PoolObject[UTF8TEXTVIEW("Height")].AsInt32();
+		Key.BombCount = PoolObject[UTF8TEXTVIEW("Bombs")].AsInt32();
+		Key.Mode = PoolObject[UTF8TEXTVIEW("Mode")].AsInt32() == int32(EMinesweeperBoardMode::NoGuess) ? EMinesweeperBoardMode::NoGuess : EMinesweeperBoardMode::Random;
+		// A damaged or hand edited file must not make the refill task allocate an enormous board
+		if (!IsValidKey(Key))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Ignoring cached %dx%d board with %d bombs in %s"), Key.Width, Key.Height, Key.BombCount, *FilePath);
+			continue;
+		}
+
+		FPool& Pool = TouchPool(Key);
+		Pool.Boards.Reset();
+
+		FCbFieldViewIterator Value = PoolObject[UTF8TEXTVIEW("Boards")].AsArrayView().CreateViewIterator();
+		while (Value && Pool.Boards.Num() < BoardsPerKey)
+		{
+			FMinesweeperCachedBoard& Board = Pool.Boards.AddDefaulted_GetRef();
+			Board.Seed = Value.AsInt32();
+			++Value;
+			if (Value)
+			{
+				Board.StartIndex = Value.AsInt32();
+				++Value;
+			}
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,222 @@
+#include "MinesweeperBoardImage.h"
+
+namespace MinesweeperBoardImage
+{
+	constexpr int32 MaxCellSize = 16;
+
+	// 3x5 glyphs, one bit per pixel, top row in the highest three bits
+	constexpr uint16 MakeGlyph(uint16 Row0, uint16 Row1, uint16 Row2, uint16 Row3, uint16 Row4)
+	{
+		return (Row0 << 12) | (Row1 << 9) | (Row2 << 6) | (Row3 << 3) | Row4;
+	}
+
+	constexpr uint16 DigitGlyphs[9] =
+	{
+		0,
+		MakeGlyph(0b010, 0b110, 0b010, 0b010, 0b111),
+		MakeGlyph(0b111, 0b001, 0b111, 0b100, 0b111),
+		MakeGlyph(0b111, 0b001, 0b111, 0b001, 0b111),
+		MakeGlyph(0b101, 0b101, 0b111, 0b001, 0b001),
+		MakeGlyph(0b111, 0b100, 0b111, 0b001, 0b111),
+		MakeGlyph(0b111, 0b100, 0b111, 0b101, 0b111),
+		MakeGlyph(0b111, 0b001, 0b001, 0b010, 0b010),
+		MakeGlyph(0b111, 0b101, 0b111, 0b101, 0b111)
+	};
+
+	constexpr uint16 FlagGlyph = MakeGlyph(0b110, 0b111, 0b110, 0b100, 0b100);
+	constexpr uint16 BombGlyph = MakeGlyph(0b101, 0b010, 0b111, 0b010, 0b101);
+	constexpr uint16 CrossGlyph = MakeGlyph(0b101, 0b101, 0b010, 0b101, 0b101);
+
+	// Same palette as the tile widgets
+	const FColor HiddenColor(178, 178, 178);
+	const FColor RevealedColor(230, 230, 230);
+	const FColor ExplodedColor(255, 77, 77);
+	const FColor BorderColor(128, 128, 128);
+
+	const FColor NumberColors[9] =
+	{
+		FColor::Black,
+		FColor(0, 0, 255),
+		FColor(0, 160, 0),
+		FColor(255, 0, 0),
+		FColor(0, 0, 128),
+		FColor(128, 0, 0),
+		FColor(0, 128, 128),
+		FColor::Black,
+		FColor(128, 128, 128)
+	};
+}
+
+FMinesweeperBoardImage::FMinesweeperBoardImage(int32 InBoardWidth, int32 InBoardHeight)
+	: BoardWidth(FMath::Max(InBoardWidth, 1))
+	, BoardHeight(FMath::Max(InBoardHeight, 1))
+	, CellSize(FMath::Clamp(MaxImageSize / FMath::Max(BoardWidth, BoardHeight), 1, MinesweeperBoardImage::MaxCellSize))
+{
+	BuildAtlas();
+
+	CellVisuals.Init(uint8(EMinesweeperCellVisual::Hidden), BoardWidth * BoardHeight);
+	Pixels.SetNumUninitialized(GetImageWidth() * GetImageHeight());
+	for (int32 Y = 0; Y < BoardHeight; Y++)
+	{
+		for (int32 X = 0; X < BoardWidth; X++)
+		{
+			BlitCell(X, Y);
+		}
+	}
+
+	DirtySpans.Init(FIntPoint(INDEX_NONE, INDEX_NONE), BoardHeight);
+	MarkAllDirty();
+}
+
+bool FMinesweeperBoardImage::SetCell(int32 X, int32 Y, EMinesweeperCellVisual Visual)
+{
+	uint8& Current = CellVisuals[Y * BoardWidth + X];
+	if (Current == uint8(Visual))
+	{
+		return false;
+	}
+
+	Current = uint8(Visual);
+	BlitCell(X, Y);
+
+	FIntPoint& Span = DirtySpans[Y];
+	if (Span.X == INDEX_NONE)
+	{
+		Span = FIntPoint(X, X);
+		DirtyRows.Add(Y);
+	}
+	else
+	{
+		Span = FIntPoint(FMath::Min(Span.X, X), FMath::Max(Span.Y, X));
+	}
+	return true;
+}
+
+void FMinesweeperBoardImage::ConsumeDirtyRegions(TArray<FIntRect>& OutRegions)
+{
+	DirtyRows.Sort();
+
+	for (int32 RowIndex = 0; RowIndex < DirtyRows.Num(); RowIndex++)
+	{
+		const int32 FirstRow = DirtyRows[RowIndex];
+		const FIntPoint Span = DirtySpans[FirstRow];
+
+		int32 LastRow = FirstRow;
+		while (RowIndex + 1 < DirtyRows.Num() && DirtyRows[RowIndex + 1] == LastRow + 1 && DirtySpans[LastRow + 1] == Span)
+		{
+			LastRow++;
+			RowIndex++;
+		}
+
+		OutRegions.Add(FIntRect(Span.X * CellSize, FirstRow * CellSize, (Span.Y + 1) * CellSize, (LastRow + 1) * CellSize));
+	}
+
+	for (int32 Row : DirtyRows)
+	{
+		DirtySpans[Row] = FIntPoint(INDEX_NONE, INDEX_NONE);
+	}
+	DirtyRows.Reset();
+}
+
+void FMinesweeperBoardImage::MarkAllDirty()
+{
+	DirtyRows.Reset();
+	for (int32 Y = 0; Y < BoardHeight; Y++)
+	{
+		DirtySpans[Y] = FIntPoint(0, BoardWidth - 1);
+		DirtyRows.Add(Y);
+	}
+}
+
+void FMinesweeperBoardImage::BuildAtlas()
+{
+	using namespace MinesweeperBoardImage;
+
+	const int32 CellArea = CellSize * CellSize;
+	Atlas.SetNumUninitialized(int32(EMinesweeperCellVisual::Num) * CellArea);
+
+	// Glyphs scale in whole texels and are skipped when the cells are too small to read them
+	const int32 GlyphScale = CellSize / 6;
+	const int32 GlyphLeft = (CellSize - 3 * GlyphScale) / 2;
+	const int32 GlyphTop = (CellSize - 5 * GlyphScale) / 2;
+
+	for (int32 VisualIndex = 0; VisualIndex < int32(EMinesweeperCellVisual::Num); VisualIndex++)
+	{
+		const EMinesweeperCellVisual Visual = EMinesweeperCellVisual(VisualIndex);
+
+		FColor Background = RevealedColor;
+		FColor GlyphColor = FColor::Black;
+		uint16 Glyph = 0;
+		if (VisualIndex <= 8)
+		{
+			Glyph = DigitGlyphs[VisualIndex];
+			GlyphColor = NumberColors[VisualIndex];
+		}
+		else
+		{
+			switch (Visual)
+			{
+			case EMinesweeperCellVisual::Hidden:
+				Background = HiddenColor;
+				break;
+			case EMinesweeperCellVisual::Flagged:
+				Background = HiddenColor;
+				Glyph = FlagGlyph;
+				GlyphColor = FColor::Red;
+				break;
+			case EMinesweeperCellVisual::Exploded:
+				Background = ExplodedColor;
+				Glyph = BombGlyph;
+				break;
+			case EMinesweeperCellVisual::Bomb:
+				Glyph = BombGlyph;
+				break;
+			case EMinesweeperCellVisual::WonBomb:
+				Glyph = BombGlyph;
+				GlyphColor = FColor::Green;
+				break;
+			case EMinesweeperCellVisual::WrongFlag:
+				Background = HiddenColor;
+				Glyph = CrossGlyph;
+				GlyphColor = FColor::Red;
+				break;
+			default:
+				break;
+			}
+		}
+
+		FColor* Block = Atlas.GetData() + VisualIndex * CellArea;
+		for (int32 PY = 0; PY < CellSize; PY++)
+		{
+			for (int32 PX = 0; PX < CellSize; PX++)
+			{
+				// Darker right and bottom edge so neighbouring cells stay distinguishable
+				const bool bBorder = CellSize >= 4 && (PX == CellSize - 1 || PY == CellSize - 1);
+				FColor Color = bBorder ? BorderColor : Background;
+
+				if (GlyphScale > 0)
+				{
+					const int32 GX = (PX - GlyphLeft) / GlyphScale;
+					const int32 GY = (PY - GlyphTop) / GlyphScale;
+					if (PX >= GlyphLeft && PY >= GlyphTop && GX < 3 && GY < 5 && (Glyph >> ((4 - GY) * 3 + (2 - GX))) & 1)
+					{
+						Color = GlyphColor;
+					}
+				}
+
+				Block[PY * CellSize + PX] = Color;
+			}
+		}
+	}
+}
+
+void FMinesweeperBoardImage::BlitCell(int32 X, int32 Y)
+{
+	const FColor* Source = Atlas.GetData() + CellVisuals[Y * BoardWidth + X] * CellSize * CellSize;
+	FColor* Dest = Pixels.GetData() + (Y * CellSize) * GetImageWidth() + X * CellSize;
+
+	for (int32 PY = 0; PY < CellSize; PY++)
+	{
+		FMemory::Memcpy(Dest + PY * GetImageWidth(), Source + PY * CellSize, CellSize * sizeof(FColor));
+	}
+}
@@ -0,0 +1,70 @@
+#include "MinesweeperBoardSummary.h"
+
+FMinesweeperBoardSummary::FMinesweeperBoardSummary(int32 InWidth, int32 InHeight)
+	: Width(FMath::Max(InWidth, 1))
+	, Height(FMath::Max(InHeight, 1))
+{
+	FIntPoint Size(Width, Height);
+	while (true)
+	{
+		FLevel& Level = Levels.AddDefaulted_GetRef();
+		Level.Size = Size;
+		Level.Blocks.SetNum(Size.X * Size.Y);
+
+		if (Size.X == 1 && Size.Y == 1)
+		{
+			break;
+		}
+		Size = FIntPoint((Size.X + 1) / 2, (Size.Y + 1) / 2);
+	}
+}
+
+void FMinesweeperBoardSummary::SetCellState(int32 X, int32 Y, EMinesweeperCellState NewState)
+{
+	// Level 0 is the cell itself, so its counts double as the previous state
+	const FCounts& Cell = Levels[0].Blocks[Y * Width + X];
+	const int32 RevealedDelta = (NewState == EMinesweeperCellState::Revealed ? 1 : 0) - Cell.Revealed;
+	const int32 FlaggedDelta = (NewState == EMinesweeperCellState::Flagged ? 1 : 0) - Cell.Flagged;
+	if (RevealedDelta == 0 && FlaggedDelta == 0)
+	{
+		return;
+	}
+
+	for (int32 LevelIndex = 0; LevelIndex < Levels.Num(); LevelIndex++)
+	{
+		FLevel& Level = Levels[LevelIndex];
+		FCounts& Block = Level.Blocks[(Y >> LevelIndex) * Level.Size.X + (X >> LevelIndex)];
+		Block.Revealed += RevealedDelta;
+		Block.Flagged += FlaggedDelta;
+	}
+}
+
+int32 FMinesweeperBoardSummary::GetBlockArea(int32 Level, int32 BlockX, int32 BlockY) const
+{
+	const int32 BlockSize = GetBlockSize(Level);
+	const int32 BlockWidth = FMath::Min(BlockSize, Width - BlockX * BlockSize);
+	const int32 BlockHeight = FMath::Min(BlockSize, Height - BlockY * BlockSize);
+	return BlockWidth * BlockHeight;
+}
+
+int32 FMinesweeperBoardSummary::FindLevelForSize(int32 MaxBlocks) const
+{
+	for (int32 LevelIndex = 0; LevelIndex < Levels.Num(); LevelIndex++)
+	{
+		if (Levels[LevelIndex].Size.X <= MaxBlocks && Levels[LevelIndex].Size.Y <= MaxBlocks)
+		{
+			return LevelIndex;
+		}
+	}
+	return Levels.Num() - 1;
+}
+
+SIZE_T FMinesweeperBoardSummary::GetAllocatedSize() const
+{
+	SIZE_T Size = Levels.GetAllocatedSize();
+	for (const FLevel& Level : Levels)
+	{
+		Size += Level.Blocks.GetAllocatedSize();
+	}
+	return Size;
+}
@@ -0,0 +1,69 @@
+#include "MinesweeperBoardTexture.h"
+#include "MinesweeperBoardImage.h"
+#include "Engine/Texture2D.h"
+#include "Misc/App.h"
+
+FMinesweeperBoardTexture::FMinesweeperBoardTexture(const FMinesweeperBoardImage& Image, const FVector2D& DisplaySize)
+	: Texture(nullptr)
+{
+	Brush.DrawAs = ESlateBrushDrawType::Image;
+	Brush.ImageSize = DisplaySize;
+
+	if (!FApp::CanEverRender())
+	{
+		UE_LOG(LogTemp, Log, TEXT("No renderer, the board image stays CPU side"));
+		return;
+	}
+
+	Texture = UTexture2D::CreateTransient(Image.GetImageWidth(), Image.GetImageHeight(), PF_B8G8R8A8);
+	if (!Texture)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to create a %dx%d board texture"), Image.GetImageWidth(), Image.GetImageHeight());
+		return;
+	}
+
+	// Cells are scaled up on screen, keep their edges sharp
+	Texture->Filter = TF_Nearest;
+	Texture->SRGB = true;
+	Texture->UpdateResource();
+
+	Brush.SetResourceObject(Texture);
+}
+
+void FMinesweeperBoardTexture::Upload(FMinesweeperBoardImage& Image)
+{
+	DirtyRegions.Reset();
+	Image.ConsumeDirtyRegions(DirtyRegions);
+	if (!Texture || DirtyRegions.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 ImageWidth = Image.GetImageWidth();
+	const FColor* Pixels = Image.GetPixels().GetData();
+
+	for (const FIntRect& Region : DirtyRegions)
+	{
+		// The render thread reads the data later, so each region gets its own packed copy that the cleanup frees
+		const int32 RegionWidth = Region.Width();
+		const int32 RegionHeight = Region.Height();
+		FColor* RegionPixels = new FColor[RegionWidth * RegionHeight];
+		for (int32 Row = 0; Row < RegionHeight; Row++)
+		{
+			FMemory::Memcpy(RegionPixels + Row * RegionWidth, Pixels + (Region.Min.Y + Row) * ImageWidth + Region.Min.X, RegionWidth * sizeof(FColor));
+		}
+
+		FUpdateTextureRegion2D* UpdateRegion = new FUpdateTextureRegion2D(Region.Min.X, Region.Min.Y, 0, 0, RegionWidth, RegionHeight);
+		Texture->UpdateTextureRegions(0, 1, UpdateRegion, RegionWidth * sizeof(FColor), sizeof(FColor), reinterpret_cast<uint8*>(RegionPixels),
+			[](uint8* SrcData, const FUpdateTextureRegion2D* Regions)
+			{
+				delete[] reinterpret_cast<FColor*>(SrcData);
+				delete Regions;
+			});
+	}
+}
+
+void FMinesweeperBoardTexture::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(Texture);
+}
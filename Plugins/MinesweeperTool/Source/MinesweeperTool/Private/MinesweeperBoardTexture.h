@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+#include "Styling/SlateBrush.h"
+
+class FMinesweeperBoardImage;
+class UTexture2D;
+
+/**
+ * Transient texture mirroring an FMinesweeperBoardImage, exposed as a Slate brush.
+ * Each Upload pushes only the image's dirty regions through UpdateTextureRegions.
+ * Without a renderer (-nullrhi, headless agents) no texture is created and uploads
+ * just drain the dirty regions, so the CPU image keeps working on its own.
+ */
+class FMinesweeperBoardTexture : public FGCObject
+{
+public:
+	FMinesweeperBoardTexture(const FMinesweeperBoardImage& Image, const FVector2D& DisplaySize);
+
+	bool IsAvailable() const { return Texture != nullptr; }
+
+	void Upload(FMinesweeperBoardImage& Image);
+
+	const FSlateBrush* GetBrush() const { return &Brush; }
+
+	// FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FMinesweeperBoardTexture"); }
+
+private:
+	TObjectPtr<UTexture2D> Texture;
+	FSlateBrush Brush;
+	TArray<FIntRect> DirtyRegions;
+};
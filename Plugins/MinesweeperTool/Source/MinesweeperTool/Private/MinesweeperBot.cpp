@@ -0,0 +1,228 @@
+#include "MinesweeperBot.h"
+#include "MinesweeperBoard.h"
+#include "MinesweeperSolver.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+void FMinesweeperLatencyHistogram::Add(double Seconds)
+{
+	const double Microseconds = Seconds * 1000000.0;
+	const int32 Bucket = Microseconds < 1.0 ? 0 : FMath::Min<int32>(FMath::FloorLog2(static_cast<uint32>(FMath::Min(Microseconds, double(MAX_uint32)))) + 1, NumBuckets - 1);
+	Buckets[Bucket]++;
+	Count++;
+}
+
+void FMinesweeperLatencyHistogram::Append(const FMinesweeperLatencyHistogram& Other)
+{
+	for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+	{
+		Buckets[Bucket] += Other.Buckets[Bucket];
+	}
+	Count += Other.Count;
+}
+
+double FMinesweeperLatencyHistogram::GetPercentileMicroseconds(double Percentile) const
+{
+	const int64 Target = FMath::CeilToInt64(Count * Percentile);
+	int64 Seen = 0;
+	for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+	{
+		Seen += Buckets[Bucket];
+		if (Seen >= Target && Seen > 0)
+		{
+			return double(1ull << Bucket);
+		}
+	}
+	return 0.0;
+}
+
+FMinesweeperBot::FMinesweeperBot(int32 Seed)
+	: Random(Seed)
+{
+}
+
+FMinesweeperBotResult FMinesweeperBot::Play(FMinesweeperBoard& Board, FMinesweeperLatencyHistogram* Histogram)
+{
+	FMinesweeperBotResult Result;
+	FMinesweeperSolver Solver(Board.GetWidth(), Board.GetHeight());
+
+	TArray<int32> Revealed;
+	auto MakeMove = [&Board, &Solver, &Revealed, &Result, Histogram](int32 Index)
+	{
+		if (Board.GetCellState(Index) != EMinesweeperCellState::Hidden)
+		{
+			return;
+		}
+
+		// Only the engine call is timed, so the histogram tracks engine cost rather than bot thinking time
+		Revealed.Reset();
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		Board.Reveal(Index % Board.GetWidth(), Index / Board.GetWidth(), &Revealed);
+		if (Histogram)
+		{
+			Histogram->Add(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles));
+		}
+		Result.Moves++;
+
+		for (int32 RevealedIndex : Revealed)
+		{
+			Solver.OnRevealed(RevealedIndex, Board.GetVisibleNumber(RevealedIndex));
+		}
+	};
+
+	// Open in the middle, where an opening is most likely
+	MakeMove(Board.ToIndex(Board.GetWidth() / 2, Board.GetHeight() / 2));
+
+	TArray<int32> Safe;
+	while (Board.GetStatus() == EMinesweeperGameStatus::Playing)
+	{
+		Safe.Reset();
+		Solver.Deduce(Safe);
+
+		if (Safe.Num() == 0)
+		{
+			Result.Guesses++;
+			MakeMove(PickGuess(Board, Solver));
+			continue;
+		}
+
+		for (int32 Index : Safe)
+		{
+			MakeMove(Index);
+		}
+	}
+
+	Result.bWon = Board.GetStatus() == EMinesweeperGameStatus::Won;
+	return Result;
+}
+
+int32 FMinesweeperBot::PickGuess(const FMinesweeperBoard& Board, const FMinesweeperSolver& Solver)
+{
+	using EKnowledge = FMinesweeperSolver::EKnowledge;
+
+	const int32 NumTiles = Board.GetNumTiles();
+
+	int32 UnknownTiles = 0;
+	for (int32 Index = 0; Index < NumTiles; Index++)
+	{
+		UnknownTiles += Solver.GetKnowledge(Index) == EKnowledge::Unknown ? 1 : 0;
+	}
+
+	// Tiles away from any number only know the global density of the remaining bombs
+	const float Density = float(Board.GetBombCount() - Solver.GetKnownMineCount()) / FMath::Max(UnknownTiles, 1);
+
+	int32 BestIndex = INDEX_NONE;
+	float BestProbability = 2.0f;
+	int32 Ties = 0;
+
+	for (int32 Index = 0; Index < NumTiles; Index++)
+	{
+		if (Solver.GetKnowledge(Index) != EKnowledge::Unknown)
+		{
+			continue;
+		}
+
+		// Frontier tiles take the most pessimistic estimate among the numbers that touch them
+		float Probability = Density;
+		bool bOnFrontier = false;
+		Solver.ForEachNeighbour(Index, [&Solver, &Probability, &bOnFrontier](int32 Number)
+		{
+			if (Solver.GetKnowledge(Number) != EKnowledge::Revealed)
+			{
+				return;
+			}
+
+			int32 Unknown = 0;
+			int32 Mines = 0;
+			Solver.ForEachNeighbour(Number, [&Solver, &Unknown, &Mines](int32 Neighbour)
+			{
+				Unknown += Solver.GetKnowledge(Neighbour) == EKnowledge::Unknown ? 1 : 0;
+				Mines += Solver.GetKnowledge(Neighbour) == EKnowledge::Mine ? 1 : 0;
+			});
+
+			const float Local = float(Solver.GetNumber(Number) - Mines) / FMath::Max(Unknown, 1);
+			Probability = bOnFrontier ? FMath::Max(Probability, Local) : Local;
+			bOnFrontier = true;
+		});
+
+		if (Probability < BestProbability)
+		{
+			BestProbability = Probability;
+			BestIndex = Index;
+			Ties = 1;
+		}
+		else if (Probability == BestProbability && Random.RandRange(0, Ties++) == 0)
+		{
+			// Reservoir sampling keeps ties uniformly random without a second pass
+			BestIndex = Index;
+		}
+	}
+
+	return BestIndex;
+}
+
+FString FMinesweeperBotHarnessReport::ToString() const
+{
+	return FString::Printf(TEXT("%d games in %.3f s: %.1f games/s, %.1f moves/s, win rate %.2f%%, move latency p50 <= %.0f us, p99 <= %.0f us, max <= %.0f us"),
+		Games, WallSeconds, GetGamesPerSecond(), GetMovesPerSecond(), GetWinRate() * 100.0,
+		MoveLatency.GetPercentileMicroseconds(0.5), MoveLatency.GetPercentileMicroseconds(0.99), MoveLatency.GetPercentileMicroseconds(1.0));
+}
+
+FMinesweeperBotHarnessReport FMinesweeperBotHarness::Run(const FMinesweeperBotHarnessSettings& Settings)
+{
+	FMinesweeperBotHarnessReport Report;
+	Report.Games = Settings.NumGames;
+
+	std::atomic<int32> Wins{0};
+	std::atomic<int64> Moves{0};
+	FCriticalSection HistogramLock;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	ParallelFor(Settings.NumGames, [&Settings, &Wins, &Moves, &HistogramLock, &Report](int32 GameIndex)
+	{
+		// FirstSeed comes from the console, so the range may run past MAX_int32
+		const int32 Seed = int32(uint32(Settings.FirstSeed) + uint32(GameIndex));
+		TSharedPtr<FMinesweeperBoard> Board = FMinesweeperBoard::Generate(Settings.Width, Settings.Height, Settings.BombCount, Seed);
+
+		// Each game fills its own histogram, the shared one is only locked once per game
+		FMinesweeperLatencyHistogram GameLatency;
+		FMinesweeperBot Bot(Seed);
+		const FMinesweeperBotResult Result = Bot.Play(*Board, &GameLatency);
+
+		Wins += Result.bWon ? 1 : 0;
+		Moves += Result.Moves;
+
+		FScopeLock Lock(&HistogramLock);
+		Report.MoveLatency.Append(GameLatency);
+	});
+
+	Report.WallSeconds = FPlatformTime::Seconds() - StartTime;
+	Report.Wins = Wins;
+	Report.Moves = Moves;
+	return Report;
+}
+
+static FAutoConsoleCommand MinesweeperBotBenchCommand(
+	TEXT("Minesweeper.BotBench"),
+	TEXT("Plays seeded games with FMinesweeperBot on all cores. Args: [Games] [Width] [Height] [Bombs] [FirstSeed]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FMinesweeperBotHarnessSettings Settings;
+		int32* const Fields[] = { &Settings.NumGames, &Settings.Width, &Settings.Height, &Settings.BombCount, &Settings.FirstSeed };
+		for (int32 ArgIndex = 0; ArgIndex < Args.Num() && ArgIndex < UE_ARRAY_COUNT(Fields); ArgIndex++)
+		{
+			*Fields[ArgIndex] = FCString::Atoi(*Args[ArgIndex]);
+		}
+
+		Settings.NumGames = FMath::Max(Settings.NumGames, 1);
+		Settings.Width = FMath::Max(Settings.Width, 2);
+		Settings.Height = FMath::Max(Settings.Height, 2);
+		Settings.BombCount = FMath::Clamp(Settings.BombCount, 1, Settings.Width * Settings.Height - 1);
+
+		const FMinesweeperBotHarnessReport Report = FMinesweeperBotHarness::Run(Settings);
+		UE_LOG(LogTemp, Display, TEXT("Minesweeper bot %dx%d/%d: %s"), Settings.Width, Settings.Height, Settings.BombCount, *Report.ToString());
+	}));
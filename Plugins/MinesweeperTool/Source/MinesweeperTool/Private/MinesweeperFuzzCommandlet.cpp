@@ -0,0 +1,59 @@
+#include "MinesweeperFuzzCommandlet.h"
+#include "MinesweeperFuzzer.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Parse.h"
+
+UMinesweeperFuzzCommandlet::UMinesweeperFuzzCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UMinesweeperFuzzCommandlet::Main(const FString& Params)
+{
+	int32 Seed = FMath::Rand();
+	int32 NumCases = MAX_int32;
+	float Minutes = 10.0f;
+
+	FParse::Value(*Params, TEXT("seed="), Seed);
+	FParse::Value(*Params, TEXT("minutes="), Minutes);
+	if (FParse::Value(*Params, TEXT("cases="), NumCases))
+	{
+		Minutes = TNumericLimits<float>::Max();
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("MinesweeperFuzz: starting at seed %d"), Seed);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double EndTime = StartTime + Minutes * 60.0;
+	double NextReport = StartTime + 10.0;
+	int64 Moves = 0;
+
+	for (int32 CaseIndex = 0; CaseIndex < NumCases; CaseIndex++)
+	{
+		// Wraps instead of overflowing for seeds near the top of the range, such as one picked by FMath::Rand
+		FString Failure;
+		if (!FMinesweeperFuzzer::RunCase(int32(uint32(Seed) + uint32(CaseIndex)), Moves, Failure))
+		{
+			UE_LOG(LogTemp, Error, TEXT("MinesweeperFuzz: divergence after %d cases: %s"), CaseIndex, *Failure);
+			return 1;
+		}
+
+		const double Now = FPlatformTime::Seconds();
+		if (Now >= NextReport)
+		{
+			UE_LOG(LogTemp, Display, TEXT("MinesweeperFuzz: %d cases, %lld moves, %.0f moves/s"), CaseIndex + 1, Moves, Moves / (Now - StartTime));
+			NextReport = Now + 10.0;
+		}
+		if (Now >= EndTime)
+		{
+			NumCases = CaseIndex + 1;
+			break;
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("MinesweeperFuzz: passed, %d cases, %lld moves in %.1f s"), NumCases, Moves, FPlatformTime::Seconds() - StartTime);
+	return 0;
+}
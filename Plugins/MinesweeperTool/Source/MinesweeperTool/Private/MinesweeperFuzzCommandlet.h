@@ -0,0 +1,21 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "MinesweeperFuzzCommandlet.generated.h"
+
+/**
+ * Long-running differential fuzz of the board engine against the reference model.
+ * UnrealEditor-Cmd MineSweep.uproject -run=MinesweeperFuzz [-seed=N] [-cases=N] [-minutes=N]
+ * Without -cases it keeps going until -minutes elapse (default 10). Returns 1 on the first divergence.
+ */
+UCLASS()
+class UMinesweeperFuzzCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UMinesweeperFuzzCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,190 @@
+#include "MinesweeperFuzzer.h"
+#include "MinesweeperBoard.h"
+#include "MinesweeperReferenceBoard.h"
+#include "Math/RandomStream.h"
+
+namespace MinesweeperFuzzer
+{
+	// The reference flood fill recurses once per tile, so keep boards small enough for any thread's stack
+	constexpr int32 MaxBoardSize = 48;
+
+	enum class EMove : uint8
+	{
+		Reveal,
+		Flag,
+		Chord
+	};
+
+	const TCHAR* GetMoveName(EMove Move)
+	{
+		switch (Move)
+		{
+		case EMove::Reveal: return TEXT("Reveal");
+		case EMove::Flag: return TEXT("Flag");
+		default: return TEXT("Chord");
+		}
+	}
+
+	FMinesweeperReferenceBoard::ETile ToReference(EMinesweeperCellState State)
+	{
+		switch (State)
+		{
+		case EMinesweeperCellState::Revealed: return FMinesweeperReferenceBoard::ETile::Revealed;
+		case EMinesweeperCellState::Flagged: return FMinesweeperReferenceBoard::ETile::Flagged;
+		default: return FMinesweeperReferenceBoard::ETile::Hidden;
+		}
+	}
+
+	/** Returns an empty string when both boards agree on the play state of every tile */
+	FString Diff(const FMinesweeperBoard& Engine, const FMinesweeperReferenceBoard& Reference)
+	{
+		const bool bEngineOver = Engine.GetStatus() != EMinesweeperGameStatus::Playing;
+		const bool bEngineWon = Engine.GetStatus() == EMinesweeperGameStatus::Won;
+		if (bEngineOver != Reference.IsGameOver() || bEngineWon != Reference.HasWon())
+		{
+			return FString::Printf(TEXT("status engine=%d reference over=%d won=%d"), int32(Engine.GetStatus()), Reference.IsGameOver(), Reference.HasWon());
+		}
+
+		if (Engine.GetFlagCount() != Reference.GetFlagCount())
+		{
+			return FString::Printf(TEXT("flag count engine=%d reference=%d"), Engine.GetFlagCount(), Reference.GetFlagCount());
+		}
+
+		// Both sides count safe tiles only, the bomb that ended a game is not included
+		if (Engine.GetRevealedCount() != Reference.GetRevealedTiles())
+		{
+			return FString::Printf(TEXT("revealed count engine=%d reference=%d"), Engine.GetRevealedCount(), Reference.GetRevealedTiles());
+		}
+
+		for (int32 Y = 0; Y < Engine.GetHeight(); Y++)
+		{
+			for (int32 X = 0; X < Engine.GetWidth(); X++)
+			{
+				const int32 Index = Engine.ToIndex(X, Y);
+				if (ToReference(Engine.GetCellState(Index)) != Reference.GetTile(X, Y))
+				{
+					return FString::Printf(TEXT("tile %d,%d state engine=%d reference=%d"), X, Y, int32(Engine.GetCellState(Index)), int32(Reference.GetTile(X, Y)));
+				}
+			}
+		}
+
+		return FString();
+	}
+
+	/** The layout never changes during a game, so bombs and adjacency are only diffed once per case */
+	FString DiffLayout(const FMinesweeperBoard& Engine, const FMinesweeperReferenceBoard& Reference)
+	{
+		for (int32 Y = 0; Y < Engine.GetHeight(); Y++)
+		{
+			for (int32 X = 0; X < Engine.GetWidth(); X++)
+			{
+				if (Engine.GetAdjacentBombs(X, Y) != Reference.CountAdjacentBombs(X, Y))
+				{
+					return FString::Printf(TEXT("tile %d,%d adjacency engine=%d reference=%d"), X, Y, Engine.GetAdjacentBombs(X, Y), Reference.CountAdjacentBombs(X, Y));
+				}
+			}
+		}
+
+		int32 Bombs = 0;
+		for (int32 Index = 0; Index < Engine.GetNumTiles(); Index++)
+		{
+			Bombs += Engine.IsBomb(Index) ? 1 : 0;
+		}
+		if (Bombs != Engine.GetBombCount())
+		{
+			return FString::Printf(TEXT("bomb count placed=%d requested=%d"), Bombs, Engine.GetBombCount());
+		}
+
+		return FString();
+	}
+}
+
+bool FMinesweeperFuzzer::RunCase(int32 Seed, int64& OutMoves, FString& OutFailure)
+{
+	using namespace MinesweeperFuzzer;
+
+	FRandomStream Random(Seed);
+
+	// Thin strips and single rows hit the edge handling hardest, so sizes start at 1
+	const int32 Width = Random.RandRange(1, MaxBoardSize);
+	const int32 Height = Random.RandRange(Width == 1 ? 2 : 1, MaxBoardSize);
+	const int32 NumTiles = Width * Height;
+
+	// Mostly realistic densities, with the occasional almost empty or almost full board
+	const float Density = Random.FRand() < 0.1f ? Random.FRand() : Random.FRandRange(0.05f, 0.3f);
+	const int32 BombCount = FMath::Clamp(FMath::RoundToInt(NumTiles * Density), 1, NumTiles - 1);
+
+	TSharedPtr<FMinesweeperBoard> Engine = FMinesweeperBoard::Generate(Width, Height, BombCount, Random.RandHelper(MAX_int32));
+	FMinesweeperReferenceBoard Reference(*Engine);
+
+	FString Failure = DiffLayout(*Engine, Reference);
+	if (Failure.IsEmpty())
+	{
+		Failure = Diff(*Engine, Reference);
+	}
+	if (!Failure.IsEmpty())
+	{
+		OutFailure = FString::Printf(TEXT("seed %d (%dx%d, %d bombs) initial state: %s"), Seed, Width, Height, BombCount, *Failure);
+		return false;
+	}
+
+	const int32 NumMoves = Random.RandRange(1, 2 * NumTiles);
+	FIntPoint Cursor(Random.RandRange(0, Width - 1), Random.RandRange(0, Height - 1));
+
+	for (int32 MoveIndex = 0; MoveIndex < NumMoves; MoveIndex++)
+	{
+		// Mix local walks with jumps, and step one tile off the board now and then
+		if (Random.FRand() < 0.3f)
+		{
+			Cursor = FIntPoint(Random.RandRange(-1, Width), Random.RandRange(-1, Height));
+		}
+		else
+		{
+			Cursor.X = FMath::Clamp(Cursor.X + Random.RandRange(-2, 2), -1, Width);
+			Cursor.Y = FMath::Clamp(Cursor.Y + Random.RandRange(-2, 2), -1, Height);
+		}
+
+		const float Roll = Random.FRand();
+		const EMove Move = Roll < 0.7f ? EMove::Reveal : (Roll < 0.9f ? EMove::Flag : EMove::Chord);
+
+		switch (Move)
+		{
+		case EMove::Reveal:
+			Engine->Reveal(Cursor.X, Cursor.Y);
+			Reference.RevealTile(Cursor.X, Cursor.Y);
+			break;
+		case EMove::Flag:
+			Engine->ToggleFlag(Cursor.X, Cursor.Y);
+			Reference.ToggleFlag(Cursor.X, Cursor.Y);
+			break;
+		case EMove::Chord:
+			Engine->Chord(Cursor.X, Cursor.Y);
+			Reference.Chord(Cursor.X, Cursor.Y);
+			break;
+		}
+		OutMoves++;
+
+		Failure = Diff(*Engine, Reference);
+		if (!Failure.IsEmpty())
+		{
+			OutFailure = FString::Printf(TEXT("seed %d (%dx%d, %d bombs) move %d %s %d,%d: %s"),
+				Seed, Width, Height, BombCount, MoveIndex, GetMoveName(Move), Cursor.X, Cursor.Y, *Failure);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FMinesweeperFuzzer::RunCases(int32 FirstSeed, int32 NumCases, int64& OutMoves, FString& OutFailure)
+{
+	for (int32 CaseIndex = 0; CaseIndex < NumCases; CaseIndex++)
+	{
+		// Wraps instead of overflowing when FirstSeed is near the top of the range
+		if (!RunCase(int32(uint32(FirstSeed) + uint32(CaseIndex)), OutMoves, OutFailure))
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Differential fuzzer for the board engine. Each case derives a board size,
+ * bomb count and move sequence from its seed, plays the moves on both
+ * FMinesweeperBoard and FMinesweeperReferenceBoard, and diffs the full board
+ * state after every move. A failing seed reproduces the exact same case.
+ */
+class FMinesweeperFuzzer
+{
+public:
+	/** Plays one case. Returns false and describes the first divergence in OutFailure */
+	static bool RunCase(int32 Seed, int64& OutMoves, FString& OutFailure);
+
+	/** Plays NumCases consecutive seeds, stopping at the first failure */
+	static bool RunCases(int32 FirstSeed, int32 NumCases, int64& OutMoves, FString& OutFailure);
+};
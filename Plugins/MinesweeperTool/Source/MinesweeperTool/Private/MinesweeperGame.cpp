@@ -1,15 +1,34 @@
 #include "MinesweeperGame.h"
 #include "MinesweeperTile.h"
+#include "MinesweeperBoard.h"
+#include "MinesweeperGameWorker.h"
+#include "MinesweeperBoardImage.h"
+#include "MinesweeperBoardTexture.h"
+#include "MinesweeperBoardSummary.h"
+#include "MinesweeperMinimap.h"
+#include "MinesweeperTelemetryOverlay.h"
+#include "MinesweeperTelemetry.h"
+#include "MinesweeperTool.h"
+#include "Async/Async.h"
 #include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Images/SImage.h"
 #include "Widgets/Layout/SScrollBox.h"
 #include "Widgets/Layout/SUniformGridPanel.h"
 #include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Framework/Docking/TabManager.h"
 #include "Math/UnrealMathUtility.h"
 #include "Misc/DefaultValueHelper.h"
 
 #define LOCTEXT_NAMESPACE "Minesweeper"
 
+SMinesweeperGame::~SMinesweeperGame()
+{
+	CancelGeneration();
+}
+
 void SMinesweeperGame::Construct(const FArguments& InArgs)
 {
 	// Default game settings
@@ -45,11 +64,14 @@ void SMinesweeperGame::Construct(const FArguments& InArgs)
                 .Text(FText::FromString(FString::FromInt(Width)))
                 .OnTextCommitted_Lambda([this](const FText&, ETextCommit::Type)
                 {
+                    // Settings changed, so a board being generated for the old ones is stale
+                    CancelGeneration();
+
                     // Validate input immediately
                     int32 NewWidth;
                     if (FDefaultValueHelper::ParseInt(WidthInput->GetText().ToString(), NewWidth))
                     {
-                        NewWidth = FMath::Clamp(NewWidth, 5, 30);
+                        NewWidth = FMath::Clamp(NewWidth, 5, GetMaxBoardSize());
                         WidthInput->SetText(FText::FromString(FString::FromInt(NewWidth)));
                     }
                 })
@@ -72,10 +94,12 @@ void SMinesweeperGame::Construct(const FArguments& InArgs)
                 .Text(FText::FromString(FString::FromInt(Height)))
                 .OnTextCommitted_Lambda([this](const FText&, ETextCommit::Type)
                 {
+                    CancelGeneration();
+
                     int32 NewHeight;
                     if (FDefaultValueHelper::ParseInt(HeightInput->GetText().ToString(), NewHeight))
                     {
-                        NewHeight = FMath::Clamp(NewHeight, 5, 30);
+                        NewHeight = FMath::Clamp(NewHeight, 5, GetMaxBoardSize());
                         HeightInput->SetText(FText::FromString(FString::FromInt(NewHeight)));
                     }
                 })
@@ -98,6 +122,8 @@ void SMinesweeperGame::Construct(const FArguments& InArgs)
                 .Text(FText::FromString(FString::FromInt(BombCount)))
                 .OnTextCommitted_Lambda([this](const FText&, ETextCommit::Type)
                 {
+                    CancelGeneration();
+
                     int32 NewBombCount;
                     if (FDefaultValueHelper::ParseInt(BombCountInput->GetText().ToString(), NewBombCount))
                     {
@@ -115,10 +141,11 @@ void SMinesweeperGame::Construct(const FArguments& InArgs)
             [
                 SAssignNew(StartButton, SButton)
                 .Text(LOCTEXT("StartGame", "Start Game"))
+                .IsEnabled_Lambda([this]() { return !IsGenerating(); })
                 .OnClicked_Lambda([this]()
                 {
-                    int32 NewWidth = FMath::Clamp(FCString::Atoi(*WidthInput->GetText().ToString()), 5, 30);
-                    int32 NewHeight = FMath::Clamp(FCString::Atoi(*HeightInput->GetText().ToString()), 5, 30);
+                    int32 NewWidth = FMath::Clamp(FCString::Atoi(*WidthInput->GetText().ToString()), 5, GetMaxBoardSize());
+                    int32 NewHeight = FMath::Clamp(FCString::Atoi(*HeightInput->GetText().ToString()), 5, GetMaxBoardSize());
                     int32 MaxBombs = NewWidth * NewHeight - 1;
                     int32 NewBombCount = FMath::Clamp(FCString::Atoi(*BombCountInput->GetText().ToString()), 1, MaxBombs);
                     
@@ -131,6 +158,67 @@ void SMinesweeperGame::Construct(const FArguments& InArgs)
                     return FReply::Handled();
                 })
             ]
+
+
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            [
+                SNew(SButton)
+                .Text(LOCTEXT("OpenAnalyzer", "Analyze Seeds"))
+                .ToolTipText(LOCTEXT("OpenAnalyzerTooltip", "Open the seed difficulty analyzer in a new tab"))
+                .OnClicked_Lambda([]()
+                {
+                    FGlobalTabmanager::Get()->TryInvokeTab(FMinesweeperToolModule::AnalyzerTabName);
+                    return FReply::Handled();
+                })
+            ]
+
+
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            .VAlign(VAlign_Center)
+            [
+                SNew(SCheckBox)
+                .ToolTipText(LOCTEXT("TextureViewTooltip", "Draw the board into a single texture instead of one widget per tile. Applies to the next game"))
+                .IsChecked_Lambda([this]() { return bUseTextureView ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+                .OnCheckStateChanged_Lambda([this](ECheckBoxState NewState) { bUseTextureView = NewState == ECheckBoxState::Checked; })
+                [
+                    SNew(STextBlock)
+                    .Text(LOCTEXT("TextureView", "Texture View"))
+                ]
+            ]
+
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            .VAlign(VAlign_Center)
+            [
+                SNew(SCheckBox)
+                .ToolTipText(LOCTEXT("NoGuessTooltip", "Only deal boards that can be solved from the opened start tile without guessing. Applies to the next game"))
+                .IsChecked_Lambda([this]() { return bNoGuess ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+                .OnCheckStateChanged_Lambda([this](ECheckBoxState NewState) { bNoGuess = NewState == ECheckBoxState::Checked; })
+                [
+                    SNew(STextBlock)
+                    .Text(LOCTEXT("NoGuess", "No Guess"))
+                ]
+            ]
+
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5)
+            .VAlign(VAlign_Center)
+            [
+                SNew(SCheckBox)
+                .ToolTipText(LOCTEXT("TelemetryTooltip", "Show timings of the last reveal, generation and paint over the board"))
+                .IsChecked_Lambda([this]() { return bShowTelemetry ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+                .OnCheckStateChanged_Lambda([this](ECheckBoxState NewState) { bShowTelemetry = NewState == ECheckBoxState::Checked; })
+                [
+                    SNew(STextBlock)
+                    .Text(LOCTEXT("Telemetry", "Telemetry"))
+                ]
+            ]
         ]
         
         
@@ -148,24 +236,51 @@ void SMinesweeperGame::Construct(const FArguments& InArgs)
         .FillHeight(1.0f)
         .Padding(5)
         [
-            SAssignNew(ScrollBox, SScrollBox)
-            + SScrollBox::Slot()
+            SNew(SHorizontalBox)
+
+            + SHorizontalBox::Slot()
+            .FillWidth(1.0f)
             [
-                SAssignNew(ContentBox, SBox)
-                .MinDesiredWidth(Width * 30)
-                .MinDesiredHeight(Height * 30)
+                SNew(SMinesweeperTelemetryOverlay)
+                .ShowStats_Lambda([this]() { return bShowTelemetry; })
+                .BoardMemory(this, &SMinesweeperGame::GetBoardMemory)
+                [
+                    SAssignNew(ScrollBox, SScrollBox)
+                    + SScrollBox::Slot()
+                    [
+                        // Large boards in the texture view are wider than the tab, so scroll both ways
+                        SAssignNew(HorizontalScrollBox, SScrollBox)
+                        .Orientation(Orient_Horizontal)
+                        + SScrollBox::Slot()
+                        [
+                            SAssignNew(ContentBox, SBox)
+                            .MinDesiredWidth(Width * 30)
+                            .MinDesiredHeight(Height * 30)
+                        ]
+                    ]
+                ]
+            ]
+
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(5, 0, 0, 0)
+            [
+                SAssignNew(Minimap, SMinesweeperMinimap)
+                .ViewRect(this, &SMinesweeperGame::GetMinimapViewRect)
+                .OnJump(this, &SMinesweeperGame::JumpTo)
             ]
         ]
     ];
 
+    Worker = MakeUnique<FMinesweeperGameWorker>();
     
     InitializeGame(Width, Height, BombCount);
 }
 
 void SMinesweeperGame::InitializeGame(int32 InWidth, int32 InHeight, int32 InBombCount)
 {
-	Width = FMath::Clamp(InWidth, 5, 30);
-	Height = FMath::Clamp(InHeight, 5, 30);
+	Width = FMath::Clamp(InWidth, 5, GetMaxBoardSize());
+	Height = FMath::Clamp(InHeight, 5, GetMaxBoardSize());
 	BombCount = FMath::Clamp(InBombCount, 1, Width * Height - 1);
 
 	RevealedTiles = 0;
@@ -176,35 +291,140 @@ void SMinesweeperGame::InitializeGame(int32 InWidth, int32 InHeight, int32 InBom
 	HeightInput->SetText(FText::FromString(FString::FromInt(Height)));
 	BombCountInput->SetText(FText::FromString(FString::FromInt(BombCount)));
 
-	GameStatusText->SetText(LOCTEXT("GameStatusReady", "Game Status: Ready"));
+	// Only one generation may be in flight; a newer request supersedes the old one
+	CancelGeneration();
 
-	// Clear existing grid
+	// Drop the old board so no clicks land on it while the new one is generated
+	Board.Reset();
+	Worker->SetBoard(nullptr);
 	Grid.Empty();
-	Grid.SetNum(Width);
+	BoardTexture.Reset();
+	BoardImage.Reset();
+	Summary.Reset();
+	Minimap->SetSummary(nullptr);
+	if (ContentBox.IsValid())
+	{
+		ContentBox->SetContent(SNullWidget::NullWidget);
+	}
 
-	// Create bomb positions
-	TArray<FIntPoint> AllPossiblePositions;
-	for (int32 X = 0; X < Width; X++)
+	FMinesweeperBoardCacheKey Key;
+	Key.Width = Width;
+	Key.Height = Height;
+	Key.BombCount = BombCount;
+	Key.Mode = bNoGuess ? EMinesweeperBoardMode::NoGuess : EMinesweeperBoardMode::Random;
+
+	GameStatusText->SetText(LOCTEXT("GameStatusGenerating", "Game Status: Generating board..."));
+	PendingControl = MakeShared<FMinesweeperGenerationControl>();
+
+	// A cached no-guess seed skips the search, but the layout is still rebuilt on the thread pool like a fresh board.
+	// Random keys are never cached, so they go straight to generation without warming a pool
+	FMinesweeperCachedBoard Cached;
+	FMinesweeperBoardCache* Cache = FMinesweeperToolModule::GetBoardCache();
+	if (Cache && Cache->Take(Key, Cached))
 	{
-		for (int32 Y = 0; Y < Height; Y++)
+		PendingBoard = Async(EAsyncExecution::ThreadPool,
+			[Key, Cached, Control = PendingControl]()
+			{
+				return FMinesweeperBoardCache::Rebuild(Key, Cached, Control.Get());
+			});
+		return;
+	}
+
+	// Shuffle and adjacency precompute run on the thread pool, the task only touches its own copies
+	PendingBoard = Async(EAsyncExecution::ThreadPool,
+		[Key, Seed = FMath::Rand(), Control = PendingControl]()
 		{
-			AllPossiblePositions.Add(FIntPoint(X, Y));
-		}
+			// Timed here rather than inside Generate, so background refills of the cache do not show up as the last generation
+			FMinesweeperTelemetryScope GenerateScope(EMinesweeperTelemetryEvent::Generate, Key.Width * Key.Height);
+			return FMinesweeperBoardCache::Generate(Key, Seed, Control.Get());
+		});
+}
+
+void SMinesweeperGame::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	DrainWorkerDeltas();
+
+	// Pushes only the cells changed this frame, or just drains them when there is no renderer
+	if (BoardTexture.IsValid())
+	{
+		BoardTexture->Upload(*BoardImage);
+	}
+
+	if (!PendingBoard.IsValid())
+	{
+		return;
+	}
+
+	if (!PendingBoard.IsReady())
+	{
+		const int32 Percent = FMath::RoundToInt(PendingControl->Progress.load(std::memory_order_relaxed) * 100.0f);
+		GameStatusText->SetText(FText::Format(LOCTEXT("GameStatusProgress", "Game Status: Generating board... {0}%"), Percent));
+		return;
 	}
 
-	// Shuffle and take first BombCount elements
-	for (int32 i = 0; i < AllPossiblePositions.Num() - 1; i++)
+	FMinesweeperGeneratedBoard NewBoard = PendingBoard.Get();
+	PendingBoard.Reset();
+	PendingControl.Reset();
+
+	// Cancelled generations never get here, so a missing board means the no-guess search gave up
+	if (NewBoard.Board.IsValid())
+	{
+		AttachBoard(NewBoard);
+	}
+	else
 	{
-		int32 j = FMath::RandRange(i, AllPossiblePositions.Num() - 1);
-		AllPossiblePositions.Swap(i, j);
+		GameStatusText->SetText(LOCTEXT("GameStatusNoGuessFailed", "Game Status: No guess-free board found, try fewer bombs"));
 	}
-	TArray<FIntPoint> BombPositions = TArray<FIntPoint>(AllPossiblePositions.GetData(), BombCount);
+}
+
+void SMinesweeperGame::AttachBoard(const FMinesweeperGeneratedBoard& NewBoard)
+{
+	BuildGrid(NewBoard.Board.ToSharedRef());
+	GameStatusText->SetText(LOCTEXT("GameStatusReady", "Game Status: Ready"));
 
-	// Debug log bomb positions
-	for (const FIntPoint& Pos : BombPositions)
+	// No-guess boards are only guaranteed from their start tile, so the game opens it for the player
+	if (NewBoard.StartIndex != INDEX_NONE)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Bomb at: %d,%d"), Pos.X, Pos.Y);
+		RevealTile(NewBoard.StartIndex % Width, NewBoard.StartIndex / Width);
 	}
+}
+
+void SMinesweeperGame::CancelGeneration()
+{
+	if (!PendingBoard.IsValid())
+	{
+		return;
+	}
+
+	// The task keeps its own reference to the control block, so dropping the future never blocks
+	PendingControl->bCancelRequested.store(true, std::memory_order_relaxed);
+	PendingBoard.Reset();
+	PendingControl.Reset();
+
+	GameStatusText->SetText(LOCTEXT("GameStatusCancelled", "Game Status: Generation cancelled"));
+}
+
+void SMinesweeperGame::BuildGrid(const TSharedRef<FMinesweeperBoard>& NewBoard)
+{
+	Board = NewBoard;
+	Worker->SetBoard(Board);
+
+	UE_LOG(LogTemp, Log, TEXT("Board ready: %dx%d with %d bombs"), Width, Height, BombCount);
+
+	Summary = MakeShared<FMinesweeperBoardSummary>(Width, Height);
+	Minimap->SetSummary(Summary);
+
+	if (bUseTextureView)
+	{
+		BuildImage();
+		return;
+	}
+
+	// Clear existing grid
+	Grid.Empty();
+	Grid.SetNum(Width);
 
 	// Create grid panel
 	TSharedPtr<SUniformGridPanel> GridPanel = SNew(SUniformGridPanel);
@@ -215,15 +435,10 @@ void SMinesweeperGame::InitializeGame(int32 InWidth, int32 InHeight, int32 InBom
 
 		for (int32 Y = 0; Y < Height; Y++)
 		{
-			bool bIsBomb = BombPositions.Contains(FIntPoint(X, Y));
-            
-			// Debug log each tile's bomb status
-			UE_LOG(LogTemp, Warning, TEXT("Creating Tile at %d,%d - Bomb: %d"), X, Y, bIsBomb);
-
 			Grid[X][Y] = SNew(SMinesweeperTile)
 				.X(X)
 				.Y(Y)
-				.IsBomb(bIsBomb)
+				.IsBomb(Board->IsBomb(X, Y))
 				.Game(SharedThis(this));
 
 			GridPanel->AddSlot(X, Y)
@@ -237,12 +452,6 @@ void SMinesweeperGame::InitializeGame(int32 InWidth, int32 InHeight, int32 InBom
 	{
 		ContentBox->SetContent(GridPanel.ToSharedRef());
 	}
-
-	// if (TSharedPtr<SBox> ContentBox = StaticCastSharedPtr<SBox>(StaticCastSharedPtr<SScrollBox>(StaticCastSharedPtr<SVerticalBox>(ChildSlot.GetWidget())->GetSlot(2).GetWidget())->GetChildren()->GetChildAt(0)))
-	// {
-	// 	ContentBox->SetContent(GridPanel.ToSharedRef());
-	// }
-	
 }
 
 void SMinesweeperGame::RevealTile(int32 X, int32 Y)
@@ -255,102 +464,157 @@ void SMinesweeperGame::RevealTile(int32 X, int32 Y)
 		return;
 	}
 
-	if (!IsValidTile(X, Y))
+	if (!Board.IsValid() || !IsValidTile(X, Y))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Invalid tile position %d,%d"), X, Y);
 		return;
 	}
 
-	if (Grid[X][Y]->IsRevealed())
+	if (IsTileRevealed(X, Y))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Tile already revealed at %d,%d"), X, Y);
+		// The board only chords once the flags around the number match it, otherwise this does nothing
+		Worker->PostChord(X, Y);
 		return;
 	}
 
-	
-	Grid[X][Y]->Reveal();
+	// The board owns the rules and the flood fill; the tiles only mirror what the worker reports back
+	Worker->PostReveal(X, Y);
+}
 
-	// Immediate game over check if this is a bomb
-	if (Grid[X][Y]->IsBomb())
+void SMinesweeperGame::DrainWorkerDeltas()
+{
+	FMinesweeperGameDelta Delta;
+	while (!bGameOver && Worker->PollDelta(Delta))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Hit bomb at %d,%d"), X, Y);
-		GameOver(false);
-		return;  // Important: return immediately
-	}
+		// Deltas for a board that has since been replaced refer to tiles that no longer exist
+		if (Delta.BoardSerial != Worker->GetBoardSerial())
+		{
+			continue;
+		}
+
+		for (const FMinesweeperFlagChange& Change : Delta.FlagChanges)
+		{
+			Summary->SetCellState(Change.Index % Width, Change.Index / Width, Change.bFlagged ? EMinesweeperCellState::Flagged : EMinesweeperCellState::Hidden);
+
+			if (BoardImage.IsValid())
+			{
+				BoardImage->SetCell(Change.Index % Width, Change.Index / Width, Change.bFlagged ? EMinesweeperCellVisual::Flagged : EMinesweeperCellVisual::Hidden);
+			}
+			else
+			{
+				Grid[Change.Index % Width][Change.Index / Width]->SetFlagged(Change.bFlagged);
+			}
+		}
+
+		for (int32 Index : Delta.Revealed)
+		{
+			Summary->SetCellState(Index % Width, Index / Width, EMinesweeperCellState::Revealed);
+
+			if (BoardImage.IsValid())
+			{
+				BoardImage->SetCell(Index % Width, Index / Width, Board->IsBomb(Index) ? EMinesweeperCellVisual::Exploded : FMinesweeperBoardImage::GetNumberVisual(Board->GetAdjacentBombs(Index)));
+			}
+			else
+			{
+				Grid[Index % Width][Index / Width]->Reveal();
+			}
+		}
 
-	RevealedTiles++;
-	UE_LOG(LogTemp, Warning, TEXT("Revealed tiles count: %d"), RevealedTiles);
+		RevealedTiles = Delta.RevealedCount;
+		UE_LOG(LogTemp, Log, TEXT("Revealed %d tile(s), total %d"), Delta.Revealed.Num(), RevealedTiles);
+
+		if (Delta.Status == EMinesweeperGameStatus::Lost)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Hit bomb"));
+			GameOver(false);
+		}
+		else if (Delta.Status == EMinesweeperGameStatus::Won)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("All non-bomb tiles revealed - WIN!"));
+			GameOver(true);
+		}
+	}
+}
 
-	// Check for win condition
-	if (RevealedTiles == (Width * Height - BombCount))
+void SMinesweeperGame::RevealAdjacentTiles(int32 X, int32 Y)
+{
+	if (!Board.IsValid() || !IsValidTile(X, Y))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("All non-bomb tiles revealed - WIN!"));
-		GameOver(true);
 		return;
 	}
 
-	// If no adjacent bombs, reveal adjacent tiles
-	int32 AdjacentBombs = CountAdjacentBombs(X, Y);
-	UE_LOG(LogTemp, Warning, TEXT("Adjacent bombs: %d"), AdjacentBombs);
-    
-	if (AdjacentBombs == 0)
+	// The delayed highlight needs tile widgets
+	if (BoardImage.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Revealing adjacent tiles"));
-		//RevealAdjacentTiles(X, Y);
 		RevealAdjacentTilesImmediate(X, Y);
+		return;
 	}
+
+	// The board's topology decides what counts as adjacent
+	Board->ForEachNeighbour(Board->ToIndex(X, Y), [this](int32 Neighbour)
+	{
+		const int32 NewX = Neighbour % Width;
+		const int32 NewY = Neighbour / Width;
+
+		Grid[NewX][NewY]->SetHighlight(true);
+		FTimerHandle UnusedHandle;
+		GWorld->GetTimerManager().SetTimer(UnusedHandle, 
+			[this, NewX, NewY]() {
+				if (IsValidTile(NewX, NewY)) {
+					Grid[NewX][NewY]->SetHighlight(false);
+					RevealTile(NewX, NewY);
+				}
+			}, 
+			0.05f, false);
+	});
 }
 
-void SMinesweeperGame::RevealAdjacentTiles(int32 X, int32 Y)
+void SMinesweeperGame::RevealAdjacentTilesImmediate(int32 X, int32 Y)
 {
-	for (int32 DX = -1; DX <= 1; DX++)
+	if (!Board.IsValid() || !IsValidTile(X, Y))
 	{
-		for (int32 DY = -1; DY <= 1; DY++)
-		{
-			if (DX == 0 && DY == 0) continue;
+		return;
+	}
 
-			int32 NewX = X + DX;
-			int32 NewY = Y + DY;
+	Board->ForEachNeighbour(Board->ToIndex(X, Y), [this](int32 Neighbour)
+	{
+		const int32 NewX = Neighbour % Width;
+		const int32 NewY = Neighbour / Width;
 
-			if (IsValidTile(NewX, NewY))
-			{
-				Grid[NewX][NewY]->SetHighlight(true);
-				FTimerHandle UnusedHandle;
-				GWorld->GetTimerManager().SetTimer(UnusedHandle, 
-					[this, NewX, NewY]() {
-						if (IsValidTile(NewX, NewY)) {
-							Grid[NewX][NewY]->SetHighlight(false);
-							RevealTile(NewX, NewY);
-						}
-					}, 
-					0.05f, false);
-			}
+		if (!IsTileRevealed(NewX, NewY))
+		{
+			RevealTile(NewX, NewY);
 		}
-	}
+	});
 }
 
-void SMinesweeperGame::RevealAdjacentTilesImmediate(int32 X, int32 Y)
+void SMinesweeperGame::GameOver(bool bWon)
 {
-	for (int32 DX = -1; DX <= 1; DX++)
-	{
-		for (int32 DY = -1; DY <= 1; DY++)
-		{
-			if (DX == 0 && DY == 0) continue;
+	bGameOver = true;
 
-			int32 NewX = X + DX;
-			int32 NewY = Y + DY;
+	if (BoardImage.IsValid())
+	{
+		GameStatusText->SetText(bWon ? LOCTEXT("GameWon", "Game Status: You Won!") : LOCTEXT("GameLost", "Game Status: Game Over!"));
 
-			if (IsValidTile(NewX, NewY) && !Grid[NewX][NewY]->IsRevealed())
+		// Same end of game reveal as the tiles below, straight into the image
+		for (int32 Y = 0; Y < Height; Y++)
+		{
+			for (int32 X = 0; X < Width; X++)
 			{
-				RevealTile(NewX, NewY);
+				// A correctly flagged bomb keeps its flag on a loss, like the tile view
+				const EMinesweeperCellVisual Cell = BoardImage->GetCell(X, Y);
+				if (Board->IsBomb(X, Y) && Cell != EMinesweeperCellVisual::Exploded && (bWon || Cell != EMinesweeperCellVisual::Flagged))
+				{
+					BoardImage->SetCell(X, Y, bWon ? EMinesweeperCellVisual::WonBomb : EMinesweeperCellVisual::Bomb);
+				}
+				else if (!bWon && Cell == EMinesweeperCellVisual::Flagged)
+				{
+					BoardImage->SetCell(X, Y, EMinesweeperCellVisual::WrongFlag);
+				}
 			}
 		}
+		return;
 	}
-}
-
-void SMinesweeperGame::GameOver(bool bWon)
-{
-	bGameOver = true;
 
 	if (bWon)
 	{
@@ -396,31 +660,123 @@ void SMinesweeperGame::ResetGame()
 
 int32 SMinesweeperGame::CountAdjacentBombs(int32 X, int32 Y) const
 {
-	int32 Count = 0;
+	// Precomputed when the board was generated
+	return Board.IsValid() && IsValidTile(X, Y) ? Board->GetAdjacentBombs(X, Y) : 0;
+}
 
-	// Check all 8 surrounding tiles
-	const int32 Directions[8][2] = {{-1,-1}, {-1,0}, {-1,1},
-								   {0,-1},          {0,1},
-								   {1,-1},  {1,0},  {1,1}};
+bool SMinesweeperGame::IsValidTile(int32 X, int32 Y) const
+{
+	//return X >= 0 && X < Width && Y >= 0 && Y < Height;
+	return X >= 0 && Y >= 0 && X < Width && Y < Height && (BoardImage.IsValid() || (Grid.IsValidIndex(X) && Grid[X].IsValidIndex(Y)));
+}
 
-	for (const auto& Dir : Directions)
+void SMinesweeperGame::ToggleFlag(int32 X, int32 Y)
+{
+	if (bGameOver || !Board.IsValid() || !IsValidTile(X, Y) || IsTileRevealed(X, Y))
 	{
-		int32 NewX = X + Dir[0];
-		int32 NewY = Y + Dir[1];
-        
-		if (IsValidTile(NewX, NewY) && Grid[NewX][NewY]->IsBomb())
+		return;
+	}
+
+	Worker->PostToggleFlag(X, Y);
+}
+
+int32 SMinesweeperGame::GetMaxBoardSize() const
+{
+	// A widget per tile stops being usable past this, the texture view scales much further
+	return bUseTextureView ? 512 : 30;
+}
+
+int64 SMinesweeperGame::GetBoardMemory() const
+{
+	// The worker mutates Board's arrays, so their size comes from what it last published
+	int64 Bytes = Board.IsValid() ? sizeof(FMinesweeperBoard) + Worker->GetBoardAllocatedSize() : 0;
+	Bytes += BoardImage.IsValid() ? sizeof(FMinesweeperBoardImage) + BoardImage->GetAllocatedSize() : 0;
+	Bytes += Summary.IsValid() ? sizeof(FMinesweeperBoardSummary) + Summary->GetAllocatedSize() : 0;
+	return Bytes;
+}
+
+FBox2D SMinesweeperGame::GetMinimapViewRect() const
+{
+	const float ViewX = HorizontalScrollBox->GetViewOffsetFraction();
+	const float ViewY = ScrollBox->GetViewOffsetFraction();
+	return FBox2D(FVector2D(ViewX, ViewY), FVector2D(ViewX + HorizontalScrollBox->GetViewFraction(), ViewY + ScrollBox->GetViewFraction()));
+}
+
+void SMinesweeperGame::JumpTo(FVector2D BoardFraction)
+{
+	// Centre the view on the point; the scroll range is the content size minus one viewport
+	auto CentreOn = [](SScrollBox& Box, float Fraction)
+	{
+		const float ViewFraction = Box.GetViewFraction();
+		if (ViewFraction < 1.0f)
 		{
-			Count++;
+			const float ContentSize = Box.GetScrollOffsetOfEnd() / (1.0f - ViewFraction);
+			Box.SetScrollOffset(FMath::Clamp((Fraction - 0.5f * ViewFraction) * ContentSize, 0.0f, Box.GetScrollOffsetOfEnd()));
 		}
+	};
+
+	CentreOn(*HorizontalScrollBox, BoardFraction.X);
+	CentreOn(*ScrollBox, BoardFraction.Y);
+}
+
+bool SMinesweeperGame::IsTileRevealed(int32 X, int32 Y) const
+{
+	if (BoardImage.IsValid())
+	{
+		const EMinesweeperCellVisual Cell = BoardImage->GetCell(X, Y);
+		return Cell != EMinesweeperCellVisual::Hidden && Cell != EMinesweeperCellVisual::Flagged;
 	}
+	return Grid[X][Y]->IsRevealed();
+}
 
-	return Count;
+void SMinesweeperGame::BuildImage()
+{
+	BoardImage = MakeUnique<FMinesweeperBoardImage>(Width, Height);
+	BoardTexture = MakeUnique<FMinesweeperBoardTexture>(*BoardImage, FVector2D(Width * 30, Height * 30));
+
+	if (ContentBox.IsValid())
+	{
+		ContentBox->SetContent(
+			SNew(SBorder)
+			.Padding(0)
+			.BorderImage(FAppStyle::GetBrush("NoBorder"))
+			.OnMouseButtonDown(this, &SMinesweeperGame::OnBoardImageClicked)
+			[
+				SNew(SImage)
+				.Image(BoardTexture->GetBrush())
+			]);
+	}
 }
 
-bool SMinesweeperGame::IsValidTile(int32 X, int32 Y) const
+FReply SMinesweeperGame::OnBoardImageClicked(const FGeometry& Geometry, const FPointerEvent& MouseEvent)
 {
-	//return X >= 0 && X < Width && Y >= 0 && Y < Height;
-	return X >= 0 && Y >= 0 && X < Width && Y < Height && Grid.IsValidIndex(X) && Grid[X].IsValidIndex(Y);
+	const FKey Button = MouseEvent.GetEffectingButton();
+	if ((Button != EKeys::LeftMouseButton && Button != EKeys::RightMouseButton) || !BoardImage.IsValid())
+	{
+		return FReply::Unhandled();
+	}
+
+	// The image may be stretched, so map through the widget's local size rather than a fixed tile size
+	const FVector2D Local = Geometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+	const FVector2D Size = Geometry.GetLocalSize();
+	const int32 X = FMath::FloorToInt(Local.X / Size.X * Width);
+	const int32 Y = FMath::FloorToInt(Local.Y / Size.Y * Height);
+
+	if (!IsValidTile(X, Y))
+	{
+		return FReply::Handled();
+	}
+
+	// Both go through the worker, the cell and the summary change once its delta is drained
+	if (Button == EKeys::RightMouseButton)
+	{
+		ToggleFlag(X, Y);
+	}
+	else if (BoardImage->GetCell(X, Y) != EMinesweeperCellVisual::Flagged)
+	{
+		RevealTile(X, Y);
+	}
+	return FReply::Handled();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,151 @@
+#include "MinesweeperGameWorker.h"
+#include "MinesweeperTelemetry.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+
+FMinesweeperGameWorker::FMinesweeperGameWorker()
+	: WorkEvent(FPlatformProcess::GetSynchEventFromPool())
+{
+	Thread = FRunnableThread::Create(this, TEXT("MinesweeperGameWorker"), 0, TPri_Normal);
+}
+
+FMinesweeperGameWorker::~FMinesweeperGameWorker()
+{
+	if (Thread)
+	{
+		// Kill calls Stop and waits for Run to return
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+	WorkEvent = nullptr;
+}
+
+void FMinesweeperGameWorker::SetBoard(TSharedPtr<FMinesweeperBoard> NewBoard)
+{
+	// The worker has not seen the new board yet, so it can still be measured here
+	BoardAllocatedSize.store(NewBoard.IsValid() ? int64(NewBoard->GetAllocatedSize()) : 0, std::memory_order_relaxed);
+
+	FCommand Command;
+	Command.Type = ECommand::SetBoard;
+	Command.BoardSerial = ++PostedBoardSerial;
+	Command.Board = MoveTemp(NewBoard);
+	Post(MoveTemp(Command));
+}
+
+void FMinesweeperGameWorker::PostReveal(int32 X, int32 Y)
+{
+	FCommand Command;
+	Command.Type = ECommand::Reveal;
+	Command.X = X;
+	Command.Y = Y;
+	Post(MoveTemp(Command));
+}
+
+void FMinesweeperGameWorker::PostToggleFlag(int32 X, int32 Y)
+{
+	FCommand Command;
+	Command.Type = ECommand::ToggleFlag;
+	Command.X = X;
+	Command.Y = Y;
+	Post(MoveTemp(Command));
+}
+
+void FMinesweeperGameWorker::PostChord(int32 X, int32 Y)
+{
+	FCommand Command;
+	Command.Type = ECommand::Chord;
+	Command.X = X;
+	Command.Y = Y;
+	Post(MoveTemp(Command));
+}
+
+void FMinesweeperGameWorker::Post(FCommand&& Command)
+{
+	Commands.Enqueue(MoveTemp(Command));
+	WorkEvent->Trigger();
+}
+
+uint32 FMinesweeperGameWorker::Run()
+{
+	while (!bStopRequested.load(std::memory_order_relaxed))
+	{
+		// Auto-reset event, a trigger that arrives while processing just causes one more pass
+		WorkEvent->Wait();
+		ProcessCommands();
+	}
+	return 0;
+}
+
+void FMinesweeperGameWorker::Stop()
+{
+	bStopRequested.store(true, std::memory_order_relaxed);
+	WorkEvent->Trigger();
+}
+
+void FMinesweeperGameWorker::ProcessCommands()
+{
+	FMinesweeperGameDelta Delta;
+	bool bChanged = false;
+
+	auto Publish = [this, &Delta, &bChanged]()
+	{
+		if (bChanged && Board.IsValid())
+		{
+			Delta.BoardSerial = BoardSerial;
+			Delta.Status = Board->GetStatus();
+			Delta.RevealedCount = Board->GetRevealedCount();
+			Deltas.Enqueue(MoveTemp(Delta));
+		}
+		Delta = FMinesweeperGameDelta();
+		bChanged = false;
+	};
+
+	FCommand Command;
+	while (Commands.Dequeue(Command))
+	{
+		if (Command.Type == ECommand::SetBoard)
+		{
+			// Reveals batched so far belong to the old board, publish them under its serial
+			Publish();
+			Board = MoveTemp(Command.Board);
+			BoardSerial = Command.BoardSerial;
+			continue;
+		}
+
+		if (!Board.IsValid() || Board->GetStatus() != EMinesweeperGameStatus::Playing)
+		{
+			continue;
+		}
+
+		if (Command.Type == ECommand::ToggleFlag)
+		{
+			if (Board->ToggleFlag(Command.X, Command.Y))
+			{
+				const int32 Index = Board->ToIndex(Command.X, Command.Y);
+				Delta.FlagChanges.Add({ Index, Board->GetCellState(Index) == EMinesweeperCellState::Flagged });
+				bChanged = true;
+			}
+			continue;
+		}
+
+		const int32 RevealedBefore = Delta.Revealed.Num();
+		FMinesweeperTelemetryScope RevealScope(EMinesweeperTelemetryEvent::Reveal);
+		if (Command.Type == ECommand::Chord)
+		{
+			Board->Chord(Command.X, Command.Y, &Delta.Revealed);
+		}
+		else
+		{
+			Board->Reveal(Command.X, Command.Y, &Delta.Revealed);
+		}
+		RevealScope.Cells = Delta.Revealed.Num() - RevealedBefore;
+		bChanged = true;
+	}
+
+	Publish();
+	BoardAllocatedSize.store(Board.IsValid() ? int64(Board->GetAllocatedSize()) : 0, std::memory_order_relaxed);
+}
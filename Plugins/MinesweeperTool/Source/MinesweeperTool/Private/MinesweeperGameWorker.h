@@ -0,0 +1,102 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+#include "MinesweeperBoard.h"
+#include <atomic>
+
+class FRunnableThread;
+
+/** A tile whose flag the worker set or cleared, in the order they were applied */
+struct FMinesweeperFlagChange
+{
+	int32 Index = INDEX_NONE;
+	bool bFlagged = false;
+};
+
+/** Everything one worker pass changed on the board, for the widget to mirror */
+struct FMinesweeperGameDelta
+{
+	/** Which board the delta belongs to, deltas for a replaced board are stale */
+	uint32 BoardSerial = 0;
+
+	TArray<int32> Revealed;
+	TArray<FMinesweeperFlagChange> FlagChanges;
+	EMinesweeperGameStatus Status = EMinesweeperGameStatus::Playing;
+	int32 RevealedCount = 0;
+};
+
+/**
+ * Plays the widget's board on a dedicated thread so a large flood fill never stalls Slate.
+ * The game thread posts input to a single-producer/single-consumer lock-free queue and
+ * drains the deltas coming back through a second one, typically once per Tick.
+ * Only the worker mutates the board's play state; the bomb layout and adjacency
+ * never change after generation, so the widget may keep reading those directly.
+ */
+class FMinesweeperGameWorker : public FRunnable
+{
+public:
+	FMinesweeperGameWorker();
+	virtual ~FMinesweeperGameWorker() override;
+
+	// Game thread side
+
+	/** Hands a new board (or none) to the worker, invalidating every delta for the previous one */
+	void SetBoard(TSharedPtr<FMinesweeperBoard> NewBoard);
+	void PostReveal(int32 X, int32 Y);
+
+	/** Flags go through the board too, so its flood fill and chords see the same flags the player does */
+	void PostToggleFlag(int32 X, int32 Y);
+	void PostChord(int32 X, int32 Y);
+
+	/** Pops the next delta, returns false when the worker has not produced any more */
+	bool PollDelta(FMinesweeperGameDelta& OutDelta) { return Deltas.Dequeue(OutDelta); }
+
+	uint32 GetBoardSerial() const { return PostedBoardSerial; }
+
+	/** Bytes the board's arrays hold, published by the worker after every pass since only it may touch them */
+	int64 GetBoardAllocatedSize() const { return BoardAllocatedSize.load(std::memory_order_relaxed); }
+
+	// FRunnable interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	enum class ECommand : uint8
+	{
+		SetBoard,
+		Reveal,
+		ToggleFlag,
+		Chord
+	};
+
+	struct FCommand
+	{
+		ECommand Type = ECommand::Reveal;
+		int32 X = 0;
+		int32 Y = 0;
+		uint32 BoardSerial = 0;
+		TSharedPtr<FMinesweeperBoard> Board;
+	};
+
+	void Post(FCommand&& Command);
+
+	/** Applies every queued command and publishes their combined effect as one delta */
+	void ProcessCommands();
+
+	TQueue<FCommand, EQueueMode::Spsc> Commands;
+	TQueue<FMinesweeperGameDelta, EQueueMode::Spsc> Deltas;
+
+	FEvent* WorkEvent;
+	std::atomic<bool> bStopRequested{false};
+	std::atomic<int64> BoardAllocatedSize{0};
+	FRunnableThread* Thread;
+
+	// Game thread only
+	uint32 PostedBoardSerial = 0;
+
+	// Worker thread only
+	TSharedPtr<FMinesweeperBoard> Board;
+	uint32 BoardSerial = 0;
+};
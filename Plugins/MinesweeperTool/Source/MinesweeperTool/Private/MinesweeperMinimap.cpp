@@ -0,0 +1,132 @@
+#include "MinesweeperMinimap.h"
+#include "MinesweeperBoardSummary.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/AppStyle.h"
+
+namespace MinesweeperMinimap
+{
+	// Blocks per side at the default zoom, and the most the wheel can zoom in to
+	constexpr int32 OverviewBlocks = 64;
+	constexpr int32 MaxDetailBlocks = 128;
+
+	const FLinearColor UnknownColor(0.35f, 0.35f, 0.35f);
+	const FLinearColor RevealedColor(0.85f, 0.85f, 0.85f);
+	const FLinearColor FlaggedColor(0.9f, 0.15f, 0.15f);
+	const FLinearColor ViewColor(1.0f, 0.8f, 0.0f);
+}
+
+void SMinesweeperMinimap::Construct(const FArguments& InArgs)
+{
+	ViewRect = InArgs._ViewRect;
+	OnJump = InArgs._OnJump;
+}
+
+void SMinesweeperMinimap::SetSummary(TSharedPtr<const FMinesweeperBoardSummary> InSummary)
+{
+	Summary = InSummary;
+	ZoomSteps = 0;
+}
+
+int32 SMinesweeperMinimap::GetDisplayLevel() const
+{
+	using namespace MinesweeperMinimap;
+
+	const int32 OverviewLevel = Summary->FindLevelForSize(OverviewBlocks);
+	const int32 FinestLevel = Summary->FindLevelForSize(MaxDetailBlocks);
+	return FMath::Clamp(OverviewLevel - ZoomSteps, FinestLevel, OverviewLevel);
+}
+
+float SMinesweeperMinimap::GetCellScale(const FGeometry& Geometry) const
+{
+	const FVector2D Size = Geometry.GetLocalSize();
+	return FMath::Min(Size.X / Summary->GetWidth(), Size.Y / Summary->GetHeight());
+}
+
+int32 SMinesweeperMinimap::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	using namespace MinesweeperMinimap;
+
+	if (!Summary.IsValid())
+	{
+		return LayerId;
+	}
+
+	const FSlateBrush* WhiteBrush = FAppStyle::GetBrush("WhiteBrush");
+	const int32 Level = GetDisplayLevel();
+	const FIntPoint LevelSize = Summary->GetLevelSize(Level);
+	const int32 BlockSize = Summary->GetBlockSize(Level);
+	const float Scale = GetCellScale(AllottedGeometry);
+
+	for (int32 BlockY = 0; BlockY < LevelSize.Y; BlockY++)
+	{
+		for (int32 BlockX = 0; BlockX < LevelSize.X; BlockX++)
+		{
+			const FMinesweeperBoardSummary::FCounts& Counts = Summary->GetBlock(Level, BlockX, BlockY);
+			const float Area = Summary->GetBlockArea(Level, BlockX, BlockY);
+			const float RevealedShare = Counts.Revealed / Area;
+			const float FlaggedShare = Counts.Flagged / Area;
+			const FLinearColor Color = UnknownColor * (1.0f - RevealedShare - FlaggedShare) + RevealedColor * RevealedShare + FlaggedColor * FlaggedShare;
+
+			// Edge blocks are clipped to the board so partial blocks are not stretched
+			const FVector2D Position(BlockX * BlockSize * Scale, BlockY * BlockSize * Scale);
+			const FVector2D Size(FMath::Min(BlockSize, Summary->GetWidth() - BlockX * BlockSize) * Scale, FMath::Min(BlockSize, Summary->GetHeight() - BlockY * BlockSize) * Scale);
+
+			FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(Size, FSlateLayoutTransform(Position)), WhiteBrush, ESlateDrawEffect::None, Color);
+		}
+	}
+
+	const FBox2D View = ViewRect.Get();
+	if (View.bIsValid)
+	{
+		const FVector2D BoardSize(Summary->GetWidth() * Scale, Summary->GetHeight() * Scale);
+		const FVector2D Min = View.Min * BoardSize;
+		const FVector2D Max = View.Max * BoardSize;
+
+		TArray<FVector2f> Outline;
+		Outline.Add(FVector2f(Min));
+		Outline.Add(FVector2f(Max.X, Min.Y));
+		Outline.Add(FVector2f(Max));
+		Outline.Add(FVector2f(Min.X, Max.Y));
+		Outline.Add(FVector2f(Min));
+		FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 1, AllottedGeometry.ToPaintGeometry(), Outline, ESlateDrawEffect::None, ViewColor, true, 1.0f);
+	}
+
+	return LayerId + 1;
+}
+
+FVector2D SMinesweeperMinimap::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	return FVector2D(160.0f, 160.0f);
+}
+
+FReply SMinesweeperMinimap::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (!Summary.IsValid() || MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton)
+	{
+		return FReply::Unhandled();
+	}
+
+	const FVector2D Local = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+	const float Scale = GetCellScale(MyGeometry);
+	const FVector2D Fraction(Local.X / (Summary->GetWidth() * Scale), Local.Y / (Summary->GetHeight() * Scale));
+
+	if (Fraction.X <= 1.0f && Fraction.Y <= 1.0f)
+	{
+		OnJump.ExecuteIfBound(Fraction);
+	}
+	return FReply::Handled();
+}
+
+FReply SMinesweeperMinimap::OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (!Summary.IsValid())
+	{
+		return FReply::Unhandled();
+	}
+
+	using namespace MinesweeperMinimap;
+
+	const int32 MaxZoomSteps = Summary->FindLevelForSize(OverviewBlocks) - Summary->FindLevelForSize(MaxDetailBlocks);
+	ZoomSteps = FMath::Clamp(ZoomSteps + (MouseEvent.GetWheelDelta() > 0.0f ? 1 : -1), 0, MaxZoomSteps);
+	return FReply::Handled();
+}
@@ -0,0 +1,151 @@
+#include "MinesweeperReferenceBoard.h"
+#include "MinesweeperBoard.h"
+
+FMinesweeperReferenceBoard::FMinesweeperReferenceBoard(const FMinesweeperBoard& Layout)
+	: Width(Layout.GetWidth())
+	, Height(Layout.GetHeight())
+	, BombCount(Layout.GetBombCount())
+{
+	Bombs.SetNum(Width);
+	Tiles.SetNum(Width);
+	for (int32 X = 0; X < Width; X++)
+	{
+		Bombs[X].SetNum(Height);
+		Tiles[X].Init(ETile::Hidden, Height);
+		for (int32 Y = 0; Y < Height; Y++)
+		{
+			Bombs[X][Y] = Layout.IsBomb(X, Y);
+		}
+	}
+}
+
+void FMinesweeperReferenceBoard::RevealTile(int32 X, int32 Y)
+{
+	if (bGameOver || !IsValidTile(X, Y))
+	{
+		return;
+	}
+
+	// Revealed tiles are ignored and flagged tiles swallow the click
+	if (Tiles[X][Y] != ETile::Hidden)
+	{
+		return;
+	}
+
+	Tiles[X][Y] = ETile::Revealed;
+
+	if (Bombs[X][Y])
+	{
+		bGameOver = true;
+		return;
+	}
+
+	RevealedTiles++;
+
+	if (RevealedTiles == (Width * Height - BombCount))
+	{
+		bGameOver = true;
+		bWon = true;
+		return;
+	}
+
+	if (CountAdjacentBombs(X, Y) == 0)
+	{
+		for (int32 DX = -1; DX <= 1; DX++)
+		{
+			for (int32 DY = -1; DY <= 1; DY++)
+			{
+				if (DX == 0 && DY == 0) continue;
+
+				if (IsValidTile(X + DX, Y + DY) && Tiles[X + DX][Y + DY] != ETile::Revealed)
+				{
+					RevealTile(X + DX, Y + DY);
+				}
+			}
+		}
+	}
+}
+
+void FMinesweeperReferenceBoard::ToggleFlag(int32 X, int32 Y)
+{
+	if (bGameOver || !IsValidTile(X, Y))
+	{
+		return;
+	}
+
+	if (Tiles[X][Y] == ETile::Hidden)
+	{
+		Tiles[X][Y] = ETile::Flagged;
+		FlagCount++;
+	}
+	else if (Tiles[X][Y] == ETile::Flagged)
+	{
+		Tiles[X][Y] = ETile::Hidden;
+		FlagCount--;
+	}
+}
+
+void FMinesweeperReferenceBoard::Chord(int32 X, int32 Y)
+{
+	if (bGameOver || !IsValidTile(X, Y) || Tiles[X][Y] != ETile::Revealed)
+	{
+		return;
+	}
+
+	int32 Flags = 0;
+	for (int32 DX = -1; DX <= 1; DX++)
+	{
+		for (int32 DY = -1; DY <= 1; DY++)
+		{
+			if ((DX != 0 || DY != 0) && IsValidTile(X + DX, Y + DY) && Tiles[X + DX][Y + DY] == ETile::Flagged)
+			{
+				Flags++;
+			}
+		}
+	}
+
+	if (Flags != CountAdjacentBombs(X, Y))
+	{
+		return;
+	}
+
+	// Same neighbour order as the engine (row by row) so the first bomb hit ends the game identically
+	for (int32 DY = -1; DY <= 1; DY++)
+	{
+		for (int32 DX = -1; DX <= 1; DX++)
+		{
+			if (DX != 0 || DY != 0)
+			{
+				RevealTile(X + DX, Y + DY);
+			}
+		}
+	}
+}
+
+int32 FMinesweeperReferenceBoard::CountAdjacentBombs(int32 X, int32 Y) const
+{
+	int32 Count = 0;
+
+	// Check all 8 surrounding tiles
+	const int32 Directions[8][2] = {{-1,-1}, {-1,0}, {-1,1},
+								   {0,-1},          {0,1},
+								   {1,-1},  {1,0},  {1,1}};
+
+	for (const auto& Dir : Directions)
+	{
+		int32 NewX = X + Dir[0];
+		int32 NewY = Y + Dir[1];
+
+		if (IsValidTile(NewX, NewY) && Bombs[NewX][NewY])
+		{
+			Count++;
+		}
+	}
+
+	return Count;
+}
+
+bool FMinesweeperReferenceBoard::IsValidTile(int32 X, int32 Y) const
+{
+	return X >= 0 && Y >= 0 && X < Width && Y < Height;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MinesweeperBoardFwd.h"
+
+/**
+ * Deliberately naive model of the game rules, kept as close as possible to the
+ * original SMinesweeperGame::RevealTile / CountAdjacentBombs: a column-major grid,
+ * adjacency counted on demand from a direction table and a recursive flood fill.
+ * Only the fuzzer uses it, as the oracle the optimised board engine is diffed against.
+ */
+class FMinesweeperReferenceBoard
+{
+public:
+	enum class ETile : uint8
+	{
+		Hidden,
+		Revealed,
+		Flagged
+	};
+
+	/** Copies the bomb layout of an engine board so both start from the same game */
+	explicit FMinesweeperReferenceBoard(const FMinesweeperBoard& Layout);
+
+	void RevealTile(int32 X, int32 Y);
+	void ToggleFlag(int32 X, int32 Y);
+	void Chord(int32 X, int32 Y);
+
+	int32 CountAdjacentBombs(int32 X, int32 Y) const;
+	bool IsValidTile(int32 X, int32 Y) const;
+
+	ETile GetTile(int32 X, int32 Y) const { return Tiles[X][Y]; }
+	int32 GetRevealedTiles() const { return RevealedTiles; }
+	int32 GetFlagCount() const { return FlagCount; }
+	bool IsGameOver() const { return bGameOver; }
+	bool HasWon() const { return bWon; }
+
+private:
+	TArray<TArray<bool>> Bombs;
+	TArray<TArray<ETile>> Tiles;
+	int32 Width;
+	int32 Height;
+	int32 BombCount;
+	int32 RevealedTiles = 0;
+	int32 FlagCount = 0;
+	bool bGameOver = false;
+	bool bWon = false;
+};
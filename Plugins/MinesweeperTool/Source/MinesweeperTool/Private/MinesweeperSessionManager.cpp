@@ -0,0 +1,193 @@
+#include "MinesweeperSessionManager.h"
+#include "Async/TaskGraphInterfaces.h"
+
+FMinesweeperBoardPool::FMinesweeperBoardPool(int32 InMaxPooledBoards)
+	: MaxPooledBoards(InMaxPooledBoards)
+{
+}
+
+TUniquePtr<FMinesweeperBoard> FMinesweeperBoardPool::Acquire(int32 Width, int32 Height)
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (TArray<TUniquePtr<FMinesweeperBoard>>* Boards = FreeBoards.Find(FIntPoint(Width, Height)))
+		{
+			if (Boards->Num() > 0)
+			{
+				NumPooled--;
+				return Boards->Pop(EAllowShrinking::No);
+			}
+		}
+	}
+
+	return MakeUnique<FMinesweeperBoard>(Width, Height);
+}
+
+void FMinesweeperBoardPool::Release(TUniquePtr<FMinesweeperBoard> Board)
+{
+	if (!Board.IsValid())
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	if (NumPooled < MaxPooledBoards)
+	{
+		NumPooled++;
+		FreeBoards.FindOrAdd(FIntPoint(Board->GetWidth(), Board->GetHeight())).Add(MoveTemp(Board));
+	}
+}
+
+FMinesweeperSessionManager::FMinesweeperSessionManager(int32 NumShards, int32 InMaxSessions, double InIdleTimeoutSeconds)
+	: MaxSessions(FMath::Max(InMaxSessions, 1))
+	, IdleTimeoutSeconds(InIdleTimeoutSeconds)
+{
+	if (NumShards <= 0)
+	{
+		NumShards = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+	}
+
+	Shards.Reserve(NumShards);
+	for (int32 ShardIndex = 0; ShardIndex < NumShards; ShardIndex++)
+	{
+		Shards.Add(MakeUnique<UE::Tasks::FPipe>(TEXT("MinesweeperSessionShard")));
+	}
+}
+
+FMinesweeperSessionManager::~FMinesweeperSessionManager()
+{
+	// Tasks hold raw board pointers, so nothing may be freed while a shard still has work
+	Flush();
+}
+
+FMinesweeperSessionId FMinesweeperSessionManager::CreateSession(int32 Width, int32 Height, int32 BombCount, int32 Seed)
+{
+	Width = FMath::Max(Width, 1);
+	Height = FMath::Max(Height, Width == 1 ? 2 : 1);
+
+	// Checked before generating so a full manager does not lay out boards only to drop them
+	const double Now = FPlatformTime::Seconds();
+	{
+		FWriteScopeLock WriteLock(SessionsLock);
+		if (Sessions.Num() >= MaxSessions)
+		{
+			EvictIdleSessions(Now - IdleTimeoutSeconds);
+			if (Sessions.Num() >= MaxSessions)
+			{
+				return 0;
+			}
+		}
+	}
+
+	// Generate outside the lock so concurrent creations do not serialise on the map
+	TUniquePtr<FSession> Session = MakeUnique<FSession>();
+	Session->Board = BoardPool.Acquire(Width, Height);
+	Session->Board->Reinitialize(BombCount, Seed);
+	Session->LastUsedSeconds.store(Now, std::memory_order_relaxed);
+
+	// Others may have filled the last slots meanwhile
+	FWriteScopeLock WriteLock(SessionsLock);
+	if (Sessions.Num() >= MaxSessions)
+	{
+		BoardPool.Release(MoveTemp(Session->Board));
+		return 0;
+	}
+
+	const FMinesweeperSessionId Id = NextSessionId++;
+	Sessions.Add(Id, MoveTemp(Session));
+	return Id;
+}
+
+bool FMinesweeperSessionManager::DestroySession(FMinesweeperSessionId Id)
+{
+	FWriteScopeLock WriteLock(SessionsLock);
+
+	TUniquePtr<FSession> Session;
+	if (!Sessions.RemoveAndCopyValue(Id, Session))
+	{
+		return false;
+	}
+
+	ReleaseSession(Id, MoveTemp(Session));
+	return true;
+}
+
+void FMinesweeperSessionManager::ReleaseSession(FMinesweeperSessionId Id, TUniquePtr<FSession> Session)
+{
+	// Queued behind the session's pending work, so no task can still be using the board when it is recycled
+	GetShard(Id).Launch(TEXT("MinesweeperSessionRelease"), [this, Board = MoveTemp(Session->Board)]() mutable
+	{
+		BoardPool.Release(MoveTemp(Board));
+	});
+}
+
+void FMinesweeperSessionManager::EvictIdleSessions(double IdleBefore)
+{
+	int32 NumEvicted = 0;
+	for (auto It = Sessions.CreateIterator(); It; ++It)
+	{
+		if (It.Value()->LastUsedSeconds.load(std::memory_order_relaxed) < IdleBefore)
+		{
+			ReleaseSession(It.Key(), MoveTemp(It.Value()));
+			It.RemoveCurrent();
+			NumEvicted++;
+		}
+	}
+
+	if (NumEvicted > 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("MinesweeperSessionManager: Evicted %d idle sessions"), NumEvicted);
+	}
+}
+
+int32 FMinesweeperSessionManager::GetNumSessions() const
+{
+	FReadScopeLock ReadLock(SessionsLock);
+	return Sessions.Num();
+}
+
+UE::Tasks::TTask<FMinesweeperMoveBatchResult> FMinesweeperSessionManager::ApplyMoves(FMinesweeperSessionId Id, TArray<FMinesweeperMove> Moves)
+{
+	return Execute(Id, [Moves = MoveTemp(Moves)](FMinesweeperBoard* Board)
+	{
+		FMinesweeperMoveBatchResult Result;
+		if (!Board)
+		{
+			return Result;
+		}
+
+		Result.bSessionFound = true;
+		for (const FMinesweeperMove& Move : Moves)
+		{
+			if (Board->GetStatus() != EMinesweeperGameStatus::Playing)
+			{
+				break;
+			}
+
+			switch (Move.Type)
+			{
+			case EMinesweeperMoveType::Reveal:
+				Board->Reveal(Move.X, Move.Y, &Result.Revealed);
+				break;
+			case EMinesweeperMoveType::Flag:
+				Board->ToggleFlag(Move.X, Move.Y);
+				break;
+			case EMinesweeperMoveType::Chord:
+				Board->Chord(Move.X, Move.Y, &Result.Revealed);
+				break;
+			}
+			Result.MovesApplied++;
+		}
+
+		Result.Status = Board->GetStatus();
+		return Result;
+	});
+}
+
+void FMinesweeperSessionManager::Flush()
+{
+	for (const TUniquePtr<UE::Tasks::FPipe>& Shard : Shards)
+	{
+		Shard->WaitUntilEmpty();
+	}
+}
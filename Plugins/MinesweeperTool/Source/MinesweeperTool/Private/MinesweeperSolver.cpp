@@ -0,0 +1,104 @@
+#include "MinesweeperSolver.h"
+
+FMinesweeperSolver::FMinesweeperSolver(int32 InWidth, int32 InHeight)
+	: Width(InWidth)
+	, Height(InHeight)
+	, KnownMines(0)
+{
+	Knowledge.Init(EKnowledge::Unknown, Width * Height);
+	Numbers.SetNumZeroed(Width * Height);
+	IsDirty.Init(false, Width * Height);
+}
+
+void FMinesweeperSolver::OnRevealed(int32 Index, int32 AdjacentBombs)
+{
+	if (Knowledge[Index] == EKnowledge::Revealed)
+	{
+		return;
+	}
+
+	Knowledge[Index] = EKnowledge::Revealed;
+	Numbers[Index] = static_cast<uint8>(AdjacentBombs);
+
+	MarkDirty(Index);
+	MarkNeighboursDirty(Index);
+}
+
+bool FMinesweeperSolver::Deduce(TArray<int32>& OutSafe)
+{
+	bool bProgress = false;
+
+	while (DirtyTiles.Num() > 0)
+	{
+		const int32 Index = DirtyTiles.Pop(EAllowShrinking::No);
+		IsDirty[Index] = false;
+
+		if (Knowledge[Index] != EKnowledge::Revealed)
+		{
+			continue;
+		}
+
+		int32 Unknown = 0;
+		int32 Mines = 0;
+		ForEachNeighbour(Index, [this, &Unknown, &Mines](int32 Neighbour)
+		{
+			Unknown += Knowledge[Neighbour] == EKnowledge::Unknown ? 1 : 0;
+			Mines += Knowledge[Neighbour] == EKnowledge::Mine ? 1 : 0;
+		});
+
+		if (Unknown == 0)
+		{
+			continue;
+		}
+
+		if (Numbers[Index] == Mines)
+		{
+			// Every bomb around this number is accounted for
+			ForEachNeighbour(Index, [this, &OutSafe](int32 Neighbour)
+			{
+				if (Knowledge[Neighbour] == EKnowledge::Unknown)
+				{
+					Knowledge[Neighbour] = EKnowledge::Safe;
+					OutSafe.Add(Neighbour);
+				}
+			});
+			bProgress = true;
+		}
+		else if (Numbers[Index] == Mines + Unknown)
+		{
+			// Every hidden neighbour has to be a bomb
+			ForEachNeighbour(Index, [this](int32 Neighbour)
+			{
+				if (Knowledge[Neighbour] == EKnowledge::Unknown)
+				{
+					Knowledge[Neighbour] = EKnowledge::Mine;
+					KnownMines++;
+					MarkNeighboursDirty(Neighbour);
+				}
+			});
+			bProgress = true;
+		}
+	}
+
+	return bProgress;
+}
+
+void FMinesweeperSolver::MarkDirty(int32 Index)
+{
+	if (!IsDirty[Index])
+	{
+		IsDirty[Index] = true;
+		DirtyTiles.Add(Index);
+	}
+}
+
+void FMinesweeperSolver::MarkNeighboursDirty(int32 Index)
+{
+	ForEachNeighbour(Index, [this](int32 Neighbour)
+	{
+		if (Knowledge[Neighbour] == EKnowledge::Revealed)
+		{
+			MarkDirty(Neighbour);
+		}
+	});
+}
@@ -0,0 +1,102 @@
+#include "MinesweeperTelemetry.h"
+#include <atomic>
+
+namespace MinesweeperTelemetry
+{
+	static_assert(FMath::IsPowerOfTwo(FMinesweeperTelemetry::Capacity), "Ring indices are masked");
+
+	/**
+	 * Seqlock slot: Sequence is odd while a writer fills the fields and 2 * (Ticket + 1)
+	 * once it is done, so a reader knows both that the copy is whole and which ticket it holds.
+	 */
+	struct FSlot
+	{
+		std::atomic<uint64> Sequence{0};
+		std::atomic<int32> Cells{0};
+		std::atomic<double> Seconds{0.0};
+	};
+
+	// One ring per event, so the per-frame paint samples never push the rarer ones out
+	struct FRing
+	{
+		FSlot Slots[FMinesweeperTelemetry::Capacity];
+		std::atomic<uint64> NextTicket{0};
+	};
+
+	FRing Rings[int32(EMinesweeperTelemetryEvent::Num)];
+
+	bool ReadSlot(const FRing& Ring, uint64 Ticket, FMinesweeperTelemetrySample& OutSample)
+	{
+		const FSlot& Slot = Ring.Slots[Ticket & (FMinesweeperTelemetry::Capacity - 1)];
+
+		const uint64 Expected = 2 * (Ticket + 1);
+		if (Slot.Sequence.load(std::memory_order_acquire) != Expected)
+		{
+			return false;
+		}
+
+		OutSample.Cells = Slot.Cells.load(std::memory_order_relaxed);
+		OutSample.Seconds = Slot.Seconds.load(std::memory_order_relaxed);
+
+		// Overwritten while copying if the sequence moved on
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return Slot.Sequence.load(std::memory_order_relaxed) == Expected;
+	}
+}
+
+void FMinesweeperTelemetry::Record(EMinesweeperTelemetryEvent Event, int32 Cells, double Seconds)
+{
+	using namespace MinesweeperTelemetry;
+
+	FRing& Ring = Rings[int32(Event)];
+	const uint64 Ticket = Ring.NextTicket.fetch_add(1, std::memory_order_relaxed);
+	FSlot& Slot = Ring.Slots[Ticket & (Capacity - 1)];
+
+	Slot.Sequence.store(2 * Ticket + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	Slot.Cells.store(Cells, std::memory_order_relaxed);
+	Slot.Seconds.store(Seconds, std::memory_order_relaxed);
+
+	Slot.Sequence.store(2 * (Ticket + 1), std::memory_order_release);
+}
+
+void FMinesweeperTelemetry::Snapshot(EMinesweeperTelemetryEvent Event, TArray<FMinesweeperTelemetrySample>& OutSamples)
+{
+	using namespace MinesweeperTelemetry;
+
+	const FRing& Ring = Rings[int32(Event)];
+	const uint64 End = Ring.NextTicket.load(std::memory_order_acquire);
+	const uint64 Begin = End > uint64(Capacity) ? End - Capacity : 0;
+
+	OutSamples.Reset(int32(End - Begin));
+	for (uint64 Ticket = Begin; Ticket < End; Ticket++)
+	{
+		FMinesweeperTelemetrySample Sample;
+		Sample.Event = Event;
+		if (ReadSlot(Ring, Ticket, Sample))
+		{
+			OutSamples.Add(Sample);
+		}
+	}
+}
+
+bool FMinesweeperTelemetry::FindLatest(EMinesweeperTelemetryEvent Event, FMinesweeperTelemetrySample& OutSample)
+{
+	using namespace MinesweeperTelemetry;
+
+	const FRing& Ring = Rings[int32(Event)];
+	const uint64 End = Ring.NextTicket.load(std::memory_order_acquire);
+	const uint64 Begin = End > uint64(Capacity) ? End - Capacity : 0;
+
+	// Newest first, a slot being rewritten right now is skipped for the one before it
+	OutSample.Event = Event;
+	for (uint64 Ticket = End; Ticket > Begin; Ticket--)
+	{
+		if (ReadSlot(Ring, Ticket - 1, OutSample))
+		{
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,115 @@
+#include "MinesweeperTelemetryOverlay.h"
+#include "MinesweeperTelemetry.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Fonts/FontMeasure.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/AppStyle.h"
+#include "Styling/CoreStyle.h"
+
+namespace MinesweeperTelemetryOverlay
+{
+	const FLinearColor BackgroundColor(0.0f, 0.0f, 0.0f, 0.75f);
+	const FLinearColor TextColor(0.9f, 0.9f, 0.9f);
+	constexpr float Margin = 6.0f;
+
+	int32 CountWidgets(SWidget& Widget)
+	{
+		int32 Count = 1;
+		FChildren* Children = Widget.GetChildren();
+		for (int32 ChildIndex = 0; ChildIndex < Children->Num(); ChildIndex++)
+		{
+			Count += CountWidgets(*Children->GetChildAt(ChildIndex));
+		}
+		return Count;
+	}
+
+	FString FormatSample(const TCHAR* Label, EMinesweeperTelemetryEvent Event, bool bWithCells)
+	{
+		FMinesweeperTelemetrySample Sample;
+		if (!FMinesweeperTelemetry::FindLatest(Event, Sample))
+		{
+			return FString::Printf(TEXT("%-9s -"), Label);
+		}
+		return bWithCells
+			? FString::Printf(TEXT("%-9s %d cells in %.3f ms"), Label, Sample.Cells, Sample.Seconds * 1000.0)
+			: FString::Printf(TEXT("%-9s %.3f ms"), Label, Sample.Seconds * 1000.0);
+	}
+
+	// Per-frame events are noisy, so their whole ring is summarised as well
+	FString FormatRing(EMinesweeperTelemetryEvent Event)
+	{
+		TArray<FMinesweeperTelemetrySample> Samples;
+		FMinesweeperTelemetry::Snapshot(Event, Samples);
+		if (Samples.Num() == 0)
+		{
+			return FString::Printf(TEXT("%-9s -"), TEXT(""));
+		}
+
+		double Total = 0.0;
+		double Max = 0.0;
+		for (const FMinesweeperTelemetrySample& Sample : Samples)
+		{
+			Total += Sample.Seconds;
+			Max = FMath::Max(Max, Sample.Seconds);
+		}
+		return FString::Printf(TEXT("%-9s avg %.3f ms, max %.3f ms over %d"), TEXT(""), Total * 1000.0 / Samples.Num(), Max * 1000.0, Samples.Num());
+	}
+}
+
+void SMinesweeperTelemetryOverlay::Construct(const FArguments& InArgs)
+{
+	ShowStats = InArgs._ShowStats;
+	BoardMemory = InArgs._BoardMemory;
+	Content = InArgs._Content.Widget;
+
+	ChildSlot
+	[
+		Content.ToSharedRef()
+	];
+}
+
+int32 SMinesweeperTelemetryOverlay::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	using namespace MinesweeperTelemetryOverlay;
+
+	// Only the content is timed, the stats below are drawn afterwards
+	int32 MaxLayerId;
+	{
+		FMinesweeperTelemetryScope PaintScope(EMinesweeperTelemetryEvent::Paint);
+		MaxLayerId = SCompoundWidget::OnPaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+	}
+
+	if (!ShowStats.Get())
+	{
+		return MaxLayerId;
+	}
+
+	const FString Text = GetStatsText();
+	const FSlateFontInfo Font = FCoreStyle::GetDefaultFontStyle("Mono", 9);
+	const FVector2D TextSize = FSlateApplication::Get().GetRenderer()->GetFontMeasureService()->Measure(Text, Font);
+
+	const FVector2D BoxSize = TextSize + FVector2D(2.0 * Margin);
+	const FVector2D BoxPosition(FMath::Max<double>(AllottedGeometry.GetLocalSize().X - BoxSize.X - Margin, 0.0), Margin);
+
+	FSlateDrawElement::MakeBox(OutDrawElements, MaxLayerId + 1, AllottedGeometry.ToPaintGeometry(BoxSize, FSlateLayoutTransform(BoxPosition)), FAppStyle::GetBrush("WhiteBrush"), ESlateDrawEffect::None, BackgroundColor);
+	FSlateDrawElement::MakeText(OutDrawElements, MaxLayerId + 2, AllottedGeometry.ToPaintGeometry(TextSize, FSlateLayoutTransform(BoxPosition + FVector2D(Margin))), Text, Font, ESlateDrawEffect::None, TextColor);
+
+	return MaxLayerId + 2;
+}
+
+FString SMinesweeperTelemetryOverlay::GetStatsText() const
+{
+	using namespace MinesweeperTelemetryOverlay;
+
+	TArray<FString> Lines;
+	Lines.Add(FormatSample(TEXT("Reveal"), EMinesweeperTelemetryEvent::Reveal, true));
+	Lines.Add(FormatSample(TEXT("Generate"), EMinesweeperTelemetryEvent::Generate, true));
+	Lines.Add(FormatSample(TEXT("Paint"), EMinesweeperTelemetryEvent::Paint, false));
+	Lines.Add(FormatRing(EMinesweeperTelemetryEvent::Paint));
+
+	// Walked on every paint while the overlay is shown, cheap next to painting the same widgets
+	Lines.Add(FString::Printf(TEXT("%-9s %d"), TEXT("Widgets"), CountWidgets(*Content)));
+	Lines.Add(FString::Printf(TEXT("%-9s %.1f KiB"), TEXT("Memory"), BoardMemory.Get() / 1024.0));
+
+	return FString::Join(Lines, TEXT("\n"));
+}
@@ -43,7 +43,6 @@ void SMinesweeperTile::Construct(const FArguments& InArgs)
         SAssignNew(TileButton, SButton)
         .ButtonStyle(HiddenButtonStyle.Get())
         .OnClicked(this, &SMinesweeperTile::OnTileClicked)
-        //.OnRightClick(this, &SMinesweeperTile::OnTileRightClicked)
         [
             SAssignNew(TileText, STextBlock)
             .Text(FText::GetEmpty())
@@ -54,7 +53,7 @@ void SMinesweeperTile::Construct(const FArguments& InArgs)
 
 FReply SMinesweeperTile::OnTileClicked()
 {
-    if (State == ETileState::Flagged)
+    if (bFlagged)
         return FReply::Handled();
 
     if (auto GamePtr = Game.Pin())
@@ -66,18 +65,27 @@ FReply SMinesweeperTile::OnTileClicked()
 
 FReply SMinesweeperTile::OnTileRightClicked()
 {
-    if (State == ETileState::Hidden)
+    // The worker's board owns the flag, SetFlagged mirrors it once the toggle has been played
+    if (auto GamePtr = Game.Pin())
     {
-        State = ETileState::Flagged;
-        TileText->SetText(LOCTEXT("FlagSymbol", "F"));
-        TileButton->SetButtonStyle(HiddenButtonStyle.Get());
+        GamePtr->ToggleFlag(X.Get(), Y.Get());
     }
-    else if (State == ETileState::Flagged)
+    return FReply::Handled();
+}
+
+void SMinesweeperTile::SetFlagged(bool bInFlagged)
+{
+    bFlagged = bInFlagged;
+    TileText->SetText(bFlagged ? LOCTEXT("FlagSymbol", "F") : FText::GetEmpty());
+}
+
+FReply SMinesweeperTile::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (MouseEvent.GetEffectingButton() == EKeys::RightMouseButton)
     {
-        State = ETileState::Hidden;
-        TileText->SetText(FText::GetEmpty());
+        return OnTileRightClicked();
     }
-    return FReply::Handled();
+    return SCompoundWidget::OnMouseButtonDown(MyGeometry, MouseEvent);
 }
 
 void SMinesweeperTile::Reveal()
@@ -90,7 +98,8 @@ void SMinesweeperTile::Reveal()
     
     UE_LOG(LogTemp, Warning, TEXT("Revealing tile at %d,%d - Bomb:%d"), X.Get(), Y.Get(), bIsBomb.Get());
     
-    if (State != ETileState::Hidden && State != ETileState::Bomb)
+    // The board never reveals flagged tiles, so only the end of the game gets here with one, and a flagged bomb keeps its flag
+    if (bFlagged || (State != ETileState::Hidden && State != ETileState::Bomb))
         return;
 
     if (bIsBomb.Get())
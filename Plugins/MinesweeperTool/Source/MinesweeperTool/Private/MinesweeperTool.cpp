@@ -4,6 +4,10 @@
 #include "MinesweeperToolStyle.h"
 #include "MinesweeperToolCommands.h"
 #include "MinesweeperGame.h"
+#include "MinesweeperAnalyzer.h"
+#include "UnrealMCPMinesweeperCommands.h"
+#include "MinesweeperBoardCache.h"
+#include "Misc/Paths.h"
 #include "LevelEditor.h"
 #include "Widgets/Docking/SDockTab.h"
 #include "Widgets/Layout/SBox.h"
@@ -11,6 +15,7 @@
 #include "ToolMenus.h"
 
 static const FName MinesweeperToolTabName("MinesweeperTool");
+const FName FMinesweeperToolModule::AnalyzerTabName("MinesweeperAnalyzer");
 
 #define LOCTEXT_NAMESPACE "FMinesweeperToolModule"
 
@@ -35,6 +40,15 @@ void FMinesweeperToolModule::StartupModule()
 	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(MinesweeperToolTabName, FOnSpawnTab::CreateRaw(this, &FMinesweeperToolModule::OnSpawnPluginTab))
 		.SetDisplayName(LOCTEXT("FMinesweeperToolTabTitle", "MinesweeperTool"))
 		.SetMenuType(ETabSpawnerMenuType::Hidden);
+
+	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(AnalyzerTabName, FOnSpawnTab::CreateRaw(this, &FMinesweeperToolModule::OnSpawnAnalyzerTab))
+		.SetDisplayName(LOCTEXT("FMinesweeperAnalyzerTabTitle", "Minesweeper Analyzer"))
+		.SetMenuType(ETabSpawnerMenuType::Hidden);
+
+	MCPCommands = MakeShared<FUnrealMCPMinesweeperCommands>();
+	MCPCommands->Register();
+
+	BoardCache = MakeShared<FMinesweeperBoardCache>(FPaths::ProjectSavedDir() / TEXT("MinesweeperTool") / TEXT("BoardCache.bin"));
 }
 
 void FMinesweeperToolModule::ShutdownModule()
@@ -51,6 +65,22 @@ void FMinesweeperToolModule::ShutdownModule()
 	FMinesweeperToolCommands::Unregister();
 
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(MinesweeperToolTabName);
+	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(AnalyzerTabName);
+
+	if (MCPCommands.IsValid())
+	{
+		MCPCommands->Unregister();
+		MCPCommands.Reset();
+	}
+
+	// Waits for the refill task and writes the pools for the next session
+	BoardCache.Reset();
+}
+
+FMinesweeperBoardCache* FMinesweeperToolModule::GetBoardCache()
+{
+	FMinesweeperToolModule* Module = FModuleManager::GetModulePtr<FMinesweeperToolModule>("MinesweeperTool");
+	return Module ? Module->BoardCache.Get() : nullptr;
 }
 
 TSharedRef<SDockTab> FMinesweeperToolModule::OnSpawnPluginTab(const FSpawnTabArgs& SpawnTabArgs)
@@ -81,6 +111,15 @@ TSharedRef<SDockTab> FMinesweeperToolModule::OnSpawnPluginTab(const FSpawnTabArg
 	// 	];
 }
 
+TSharedRef<SDockTab> FMinesweeperToolModule::OnSpawnAnalyzerTab(const FSpawnTabArgs& SpawnTabArgs)
+{
+	return SNew(SDockTab)
+		.TabRole(ETabRole::NomadTab)
+		[
+			SNew(SMinesweeperAnalyzer)
+		];
+}
+
 void FMinesweeperToolModule::PluginButtonClicked()
 {
 	FGlobalTabmanager::Get()->TryInvokeTab(MinesweeperToolTabName);
@@ -0,0 +1,113 @@
+#include "Misc/AutomationTest.h"
+#include "MinesweeperBoardCache.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/CompactBinaryWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MinesweeperBoardCacheTest
+{
+	void AddPool(FCbWriter& Writer, int32 Width, int32 Height, int32 BombCount, EMinesweeperBoardMode Mode, std::initializer_list<int32> SeedsAndStarts)
+	{
+		Writer.BeginObject();
+		Writer.AddInteger(UTF8TEXTVIEW("Width"), Width);
+		Writer.AddInteger(UTF8TEXTVIEW("Height"), Height);
+		Writer.AddInteger(UTF8TEXTVIEW("Bombs"), BombCount);
+		Writer.AddInteger(UTF8TEXTVIEW("Mode"), int32(Mode));
+		Writer.BeginArray(UTF8TEXTVIEW("Boards"));
+		for (int32 Value : SeedsAndStarts)
+		{
+			Writer.AddInteger(Value);
+		}
+		Writer.EndArray();
+		Writer.EndObject();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMinesweeperBoardCacheRoundTripTest, "MinesweeperTool.Engine.BoardCacheRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMinesweeperBoardCacheRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace MinesweeperBoardCacheTest;
+
+	const FString FilePath = FPaths::CreateTempFilename(*FPaths::AutomationTransientDir(), TEXT("BoardCache"), TEXT(".bin"));
+	ON_SCOPE_EXIT
+	{
+		IFileManager::Get().Delete(*FilePath);
+	};
+
+	// Beginner boards turn up guess-free within a few seeds, so the pool fills long before the deadline
+	const FMinesweeperBoardCacheKey Key = { 9, 9, 10, EMinesweeperBoardMode::NoGuess };
+	{
+		FMinesweeperBoardCache Cache(FilePath);
+		Cache.Prewarm(Key);
+
+		const double Deadline = FPlatformTime::Seconds() + 10.0;
+		while (Cache.GetNumReady(Key) < FMinesweeperBoardCache::BoardsPerKey && FPlatformTime::Seconds() < Deadline)
+		{
+			FPlatformProcess::Sleep(0.01f);
+		}
+		TestEqual(TEXT("The pool fills"), Cache.GetNumReady(Key), FMinesweeperBoardCache::BoardsPerKey);
+	}
+
+	// Saved on destruction, read back before the new cache's refill task can add anything
+	{
+		FMinesweeperBoardCache Cache(FilePath);
+		TestEqual(TEXT("The pool survives a save and load"), Cache.GetNumReady(Key), FMinesweeperBoardCache::BoardsPerKey);
+
+		FMinesweeperCachedBoard Cached;
+		if (TestTrue(TEXT("A loaded board can be taken"), Cache.Take(Key, Cached)))
+		{
+			const FMinesweeperGeneratedBoard Rebuilt = FMinesweeperBoardCache::Rebuild(Key, Cached);
+			TestTrue(TEXT("The loaded seed rebuilds the configured board"),
+				Rebuilt.Board.IsValid() && Rebuilt.Board->GetWidth() == Key.Width && Rebuilt.Board->GetHeight() == Key.Height && Rebuilt.Board->GetBombCount() == Key.BombCount);
+			TestTrue(TEXT("The start tile survives and is safe"), Rebuilt.StartIndex == Cached.StartIndex && !Rebuilt.Board->IsBomb(Rebuilt.StartIndex));
+		}
+
+		FMinesweeperCachedBoard Unused;
+		TestFalse(TEXT("Random boards are not cached"), Cache.Take({ 9, 9, 10, EMinesweeperBoardMode::Random }, Unused));
+		TestEqual(TEXT("Asking for a random board does not warm a pool for it"), Cache.GetNumReady({ 9, 9, 10, EMinesweeperBoardMode::Random }), 0);
+	}
+
+	// A hand written file with keys the game could never ask for, next to a valid one
+	FCbWriter Writer;
+	Writer.BeginObject();
+	Writer.AddInteger(UTF8TEXTVIEW("Version"), 1);
+	Writer.BeginArray(UTF8TEXTVIEW("Pools"));
+	AddPool(Writer, 65536, 65536, 10, EMinesweeperBoardMode::NoGuess, { 1, 0 });
+	AddPool(Writer, 100000, 9, 10, EMinesweeperBoardMode::NoGuess, { 2, 0 });
+	AddPool(Writer, 3, 9, 5, EMinesweeperBoardMode::NoGuess, { 3, 0 });
+	AddPool(Writer, 9, 9, 81, EMinesweeperBoardMode::NoGuess, { 4, 0 });
+	AddPool(Writer, 9, 9, 0, EMinesweeperBoardMode::NoGuess, { 5, 0 });
+	AddPool(Writer, 11, 11, 12, EMinesweeperBoardMode::Random, { 6, -1 });
+	AddPool(Writer, 12, 10, 20, EMinesweeperBoardMode::NoGuess, { 7, 0, 8, 0, 9, 0 });
+	Writer.EndArray();
+	Writer.EndObject();
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(Writer.GetSaveSize());
+	Writer.Save(MakeMemoryView(Buffer));
+	if (!TestTrue(TEXT("Writes the hand made file"), FFileHelper::SaveArrayToFile(Buffer, *FilePath)))
+	{
+		return false;
+	}
+
+	{
+		FMinesweeperBoardCache Cache(FilePath);
+		TestEqual(TEXT("Sides whose product overflows are dropped"), Cache.GetNumReady({ 65536, 65536, 10, EMinesweeperBoardMode::NoGuess }), 0);
+		TestEqual(TEXT("Sides above the game's limit are dropped"), Cache.GetNumReady({ 100000, 9, 10, EMinesweeperBoardMode::NoGuess }), 0);
+		TestEqual(TEXT("Sides below the game's limit are dropped"), Cache.GetNumReady({ 3, 9, 5, EMinesweeperBoardMode::NoGuess }), 0);
+		TestEqual(TEXT("A board without a safe tile is dropped"), Cache.GetNumReady({ 9, 9, 81, EMinesweeperBoardMode::NoGuess }), 0);
+		TestEqual(TEXT("A board without bombs is dropped"), Cache.GetNumReady({ 9, 9, 0, EMinesweeperBoardMode::NoGuess }), 0);
+		TestEqual(TEXT("A random pool from an older file is dropped"), Cache.GetNumReady({ 11, 11, 12, EMinesweeperBoardMode::Random }), 0);
+		TestTrue(TEXT("The valid pool is kept"), Cache.GetNumReady({ 12, 10, 20, EMinesweeperBoardMode::NoGuess }) >= 3);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,67 @@
+#include "Misc/AutomationTest.h"
+#include "MinesweeperBoardImage.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMinesweeperBoardImageTest, "MinesweeperTool.Rendering.BoardImage",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMinesweeperBoardImageTest::RunTest(const FString& Parameters)
+{
+	// Runs entirely on the CPU image, so it passes on agents without a GPU
+	FMinesweeperBoardImage Image(10, 8);
+	const int32 CellSize = Image.GetCellSize();
+
+	TArray<FIntRect> Regions;
+	Image.ConsumeDirtyRegions(Regions);
+	TestEqual(TEXT("A new image is one full dirty region"), Regions.Num(), 1);
+	if (Regions.Num() == 1)
+	{
+		TestTrue(TEXT("Full region covers the image"), Regions[0] == FIntRect(0, 0, Image.GetImageWidth(), Image.GetImageHeight()));
+	}
+
+	Regions.Reset();
+	Image.ConsumeDirtyRegions(Regions);
+	TestEqual(TEXT("Consuming clears the dirty state"), Regions.Num(), 0);
+
+	TestFalse(TEXT("Setting the current visual is not a change"), Image.SetCell(0, 0, EMinesweeperCellVisual::Hidden));
+
+	// Two cells on one row, one below the second: a span on row 2 and a single cell on row 3
+	Image.SetCell(3, 2, FMinesweeperBoardImage::GetNumberVisual(0));
+	Image.SetCell(6, 2, EMinesweeperCellVisual::Flagged);
+	Image.SetCell(6, 3, EMinesweeperCellVisual::Exploded);
+	Image.ConsumeDirtyRegions(Regions);
+	TestEqual(TEXT("Different spans on consecutive rows stay separate"), Regions.Num(), 2);
+	if (Regions.Num() == 2)
+	{
+		TestTrue(TEXT("Row span"), Regions[0] == FIntRect(3 * CellSize, 2 * CellSize, 7 * CellSize, 3 * CellSize));
+		TestTrue(TEXT("Single cell"), Regions[1] == FIntRect(6 * CellSize, 3 * CellSize, 7 * CellSize, 4 * CellSize));
+	}
+
+	// Identical spans on consecutive rows merge into one rectangle
+	Regions.Reset();
+	Image.SetCell(1, 5, EMinesweeperCellVisual::Bomb);
+	Image.SetCell(1, 6, EMinesweeperCellVisual::Bomb);
+	Image.ConsumeDirtyRegions(Regions);
+	TestEqual(TEXT("Matching spans merge"), Regions.Num(), 1);
+
+	// Texels follow the cell: a revealed zero does not look like the hidden cell next to it
+	const TArray<FColor>& Pixels = Image.GetPixels();
+	const int32 Pitch = Image.GetImageWidth();
+	const FColor RevealedInterior = Pixels[(2 * CellSize + 1) * Pitch + 3 * CellSize + 1];
+	const FColor HiddenInterior = Pixels[(2 * CellSize + 1) * Pitch + 2 * CellSize + 1];
+	TestTrue(TEXT("Revealed and hidden cells look different"), RevealedInterior != HiddenInterior);
+
+	// The picture only depends on the cells, not on the order they changed in
+	FMinesweeperBoardImage Reference(10, 8);
+	Reference.SetCell(1, 6, EMinesweeperCellVisual::Bomb);
+	Reference.SetCell(6, 3, EMinesweeperCellVisual::Exploded);
+	Reference.SetCell(1, 5, EMinesweeperCellVisual::Bomb);
+	Reference.SetCell(6, 2, EMinesweeperCellVisual::Flagged);
+	Reference.SetCell(3, 2, FMinesweeperBoardImage::GetNumberVisual(0));
+	TestTrue(TEXT("Same cells give identical texels"), FMemory::Memcmp(Reference.GetPixels().GetData(), Pixels.GetData(), Pixels.Num() * sizeof(FColor)) == 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,22 @@
+#include "Misc/AutomationTest.h"
+#include "MinesweeperFuzzer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMinesweeperDifferentialFuzzTest, "MinesweeperTool.Engine.DifferentialFuzz",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMinesweeperDifferentialFuzzTest::RunTest(const FString& Parameters)
+{
+	// Fixed seeds keep the test deterministic; the commandlet covers long random runs
+	const int32 NumCases = 200;
+
+	int64 Moves = 0;
+	FString Failure;
+	const bool bPassed = FMinesweeperFuzzer::RunCases(0, NumCases, Moves, Failure);
+
+	TestTrue(FString::Printf(TEXT("Engine matches reference (%d cases, %lld moves). %s"), NumCases, Moves, *Failure), bPassed);
+	return bPassed;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
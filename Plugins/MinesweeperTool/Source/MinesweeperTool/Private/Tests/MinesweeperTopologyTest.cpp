@@ -0,0 +1,133 @@
+#include "Misc/AutomationTest.h"
+#include "MinesweeperBoard.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MinesweeperTopologyTest
+{
+	/** Sorted, but duplicates are kept so a tile visited twice fails the comparison */
+	template <typename TopologyType>
+	TArray<int32> GetNeighbours(const TMinesweeperBoard<TopologyType>& Board, int32 Index)
+	{
+		TArray<int32> Neighbours;
+		Board.ForEachNeighbour(Index, [&Neighbours](int32 Neighbour) { Neighbours.Add(Neighbour); });
+		Neighbours.Sort();
+		return Neighbours;
+	}
+
+	template <typename TopologyType>
+	void TestNeighbours(FAutomationTestBase& Test, const TCHAR* What, const TMinesweeperBoard<TopologyType>& Board, int32 Index, const TArray<int32>& Expected)
+	{
+		const TArray<int32> Neighbours = GetNeighbours(Board, Index);
+		Test.TestTrue(FString::Printf(TEXT("%s: got [%s]"), What, *FString::JoinBy(Neighbours, TEXT(", "), [](int32 Neighbour) { return FString::FromInt(Neighbour); })), Neighbours == Expected);
+	}
+
+	/**
+	 * Revealing an empty tile must reveal exactly the empty tiles reachable from it through
+	 * other empty tiles plus the numbers bordering them, each once. The expected set is
+	 * rebuilt by a plain breadth first search, with a single bomb so the region is large.
+	 */
+	template <typename TopologyType>
+	void TestFloodFill(FAutomationTestBase& Test, const TCHAR* Name, int32 Width, int32 Height, int32 Depth = 1)
+	{
+		for (int32 Seed = 0; Seed < 8; Seed++)
+		{
+			TSharedPtr<TMinesweeperBoard<TopologyType>> Board = TMinesweeperBoard<TopologyType>::Generate(Width, Height, 1, Seed, nullptr, Depth);
+			const int32 NumTiles = Board->GetNumTiles();
+			Test.TestEqual(FString::Printf(TEXT("%s has every layer"), Name), NumTiles, Width * Height * Depth);
+
+			int32 Start = 0;
+			while (Board->IsBomb(Start) || Board->GetAdjacentBombs(Start) != 0)
+			{
+				Start++;
+			}
+
+			TArray<int32> Expected = { Start };
+			TBitArray<> Seen(false, NumTiles);
+			Seen[Start] = true;
+			for (int32 QueueIndex = 0; QueueIndex < Expected.Num(); QueueIndex++)
+			{
+				const int32 Index = Expected[QueueIndex];
+				if (Board->GetAdjacentBombs(Index) != 0)
+				{
+					continue;
+				}
+				Board->ForEachNeighbour(Index, [&Board, &Seen, &Expected](int32 Neighbour)
+				{
+					if (!Seen[Neighbour] && !Board->IsBomb(Neighbour))
+					{
+						Seen[Neighbour] = true;
+						Expected.Add(Neighbour);
+					}
+				});
+			}
+
+			TArray<int32> Revealed;
+			Board->RevealIndex(Start, &Revealed);
+			Revealed.Sort();
+			Expected.Sort();
+
+			Test.TestTrue(FString::Printf(TEXT("%s seed %d reveals the empty region and its border"), Name, Seed), Revealed == Expected);
+			Test.TestEqual(FString::Printf(TEXT("%s seed %d counts what it revealed"), Name, Seed), Board->GetRevealedCount(), Revealed.Num());
+			Test.TestTrue(FString::Printf(TEXT("%s seed %d is still safe"), Name, Seed), Board->GetStatus() != EMinesweeperGameStatus::Lost);
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMinesweeperTopologyNeighboursTest, "MinesweeperTool.Engine.TopologyNeighbours",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMinesweeperTopologyNeighboursTest::RunTest(const FString& Parameters)
+{
+	using namespace MinesweeperTopologyTest;
+
+	// 3x3, indices row-major
+	const TMinesweeperBoard<FMinesweeperSquare4Topology> Square4(3, 3);
+	TestNeighbours(*this, TEXT("Square4 centre"), Square4, 4, { 1, 3, 5, 7 });
+	TestNeighbours(*this, TEXT("Square4 corner"), Square4, 0, { 1, 3 });
+	TestNeighbours(*this, TEXT("Square4 edge"), Square4, 5, { 2, 4, 8 });
+
+	// 4x4 odd-r: odd rows lean right, even rows lean left
+	const TMinesweeperBoard<FMinesweeperHex6Topology> Hex6(4, 4);
+	TestNeighbours(*this, TEXT("Hex6 odd row"), Hex6, 5, { 1, 2, 4, 6, 9, 10 });
+	TestNeighbours(*this, TEXT("Hex6 even row"), Hex6, 9, { 4, 5, 8, 10, 12, 13 });
+	TestNeighbours(*this, TEXT("Hex6 corner"), Hex6, 0, { 1, 4 });
+	TestNeighbours(*this, TEXT("Hex6 odd row end"), Hex6, 7, { 3, 6, 11 });
+
+	// 4x4 with the edges joined: the corner sees the opposite corner, rows and columns
+	const TMinesweeperBoard<FMinesweeperTorusTopology> Torus(4, 4);
+	TestNeighbours(*this, TEXT("Torus corner"), Torus, 0, { 1, 3, 4, 5, 7, 12, 13, 15 });
+	TestNeighbours(*this, TEXT("Torus centre"), Torus, 5, { 0, 1, 2, 4, 6, 8, 9, 10 });
+
+	// 3x3x3, index (Z * 3 + Y) * 3 + X
+	const TMinesweeperBoard<FMinesweeperCube26Topology> Cube26(3, 3, 3);
+	TArray<int32> AllButCentre;
+	for (int32 Index = 0; Index < 27; Index++)
+	{
+		if (Index != 13)
+		{
+			AllButCentre.Add(Index);
+		}
+	}
+	TestNeighbours(*this, TEXT("Cube26 centre"), Cube26, 13, AllButCentre);
+	TestNeighbours(*this, TEXT("Cube26 corner"), Cube26, 0, { 1, 3, 4, 9, 10, 12, 13 });
+	TestNeighbours(*this, TEXT("Cube26 top face centre"), Cube26, 22, { 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 23, 24, 25, 26 });
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMinesweeperTopologyFloodFillTest, "MinesweeperTool.Engine.TopologyFloodFill",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMinesweeperTopologyFloodFillTest::RunTest(const FString& Parameters)
+{
+	using namespace MinesweeperTopologyTest;
+
+	TestFloodFill<FMinesweeperSquare4Topology>(*this, TEXT("Square4"), 5, 5);
+	TestFloodFill<FMinesweeperHex6Topology>(*this, TEXT("Hex6"), 6, 5);
+	TestFloodFill<FMinesweeperTorusTopology>(*this, TEXT("Torus"), 5, 5);
+	TestFloodFill<FMinesweeperCube26Topology>(*this, TEXT("Cube26"), 5, 5, 4);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
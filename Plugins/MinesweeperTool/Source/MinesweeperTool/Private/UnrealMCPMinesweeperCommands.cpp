@@ -0,0 +1,283 @@
+#include "UnrealMCPMinesweeperCommands.h"
+#include "MinesweeperSessionManager.h"
+#include "Commands/UnrealMCPCommandRegistry.h"
+#include "Commands/UnrealMCPCommonUtils.h"
+#include "Misc/Base64.h"
+
+namespace MinesweeperMCP
+{
+	// Keeps a single request from allocating an unreasonable board
+	constexpr int32 MaxBoardSize = 1024;
+
+	// Cell codes used by ms_get_board, 0-8 are revealed numbers
+	constexpr uint8 CellHidden = 9;
+	constexpr uint8 CellFlagged = 10;
+	constexpr uint8 CellExploded = 11;
+	constexpr uint8 CellBomb = 12;
+
+	struct FBoardSnapshot
+	{
+		bool bSessionFound = false;
+		int32 Width = 0;
+		int32 Height = 0;
+		int32 BombCount = 0;
+		int32 FlagCount = 0;
+		int32 RevealedCount = 0;
+		EMinesweeperGameStatus Status = EMinesweeperGameStatus::Playing;
+		TArray<uint8> PackedCells;
+	};
+
+	const TCHAR* GetStatusName(EMinesweeperGameStatus Status)
+	{
+		switch (Status)
+		{
+		case EMinesweeperGameStatus::Won: return TEXT("won");
+		case EMinesweeperGameStatus::Lost: return TEXT("lost");
+		default: return TEXT("playing");
+		}
+	}
+
+	bool ParseMoveType(const FString& Op, EMinesweeperMoveType& OutType)
+	{
+		if (Op == TEXT("reveal"))
+		{
+			OutType = EMinesweeperMoveType::Reveal;
+		}
+		else if (Op == TEXT("flag"))
+		{
+			OutType = EMinesweeperMoveType::Flag;
+		}
+		else if (Op == TEXT("chord"))
+		{
+			OutType = EMinesweeperMoveType::Chord;
+		}
+		else
+		{
+			return false;
+		}
+		return true;
+	}
+
+	uint8 GetCellCode(const FMinesweeperBoard& Board, int32 Index)
+	{
+		switch (Board.GetCellState(Index))
+		{
+		case EMinesweeperCellState::Revealed:
+			return Board.IsBomb(Index) ? CellExploded : uint8(Board.GetAdjacentBombs(Index));
+		case EMinesweeperCellState::Flagged:
+			return CellFlagged;
+		default:
+			// Bombs are only exposed once the game can no longer be played
+			return Board.GetStatus() != EMinesweeperGameStatus::Playing && Board.IsBomb(Index) ? CellBomb : CellHidden;
+		}
+	}
+
+	bool GetSessionId(const TSharedPtr<FJsonObject>& Params, FMinesweeperSessionId& OutId)
+	{
+		int64 Id = 0;
+		if (!Params->TryGetNumberField(TEXT("session_id"), Id) || Id <= 0)
+		{
+			return false;
+		}
+		OutId = FMinesweeperSessionId(Id);
+		return true;
+	}
+}
+
+FUnrealMCPMinesweeperCommands::FUnrealMCPMinesweeperCommands()
+	: Sessions(MakeUnique<FMinesweeperSessionManager>())
+{
+}
+
+FUnrealMCPMinesweeperCommands::~FUnrealMCPMinesweeperCommands()
+{
+}
+
+void FUnrealMCPMinesweeperCommands::Register()
+{
+	// Sessions serialise their own work and touch no UObjects, so none of these needs the game thread
+	FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
+	Registry.RegisterCommand(TEXT("ms_new_game"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPMinesweeperCommands::HandleNewGame), EMCPCommandThread::AnyThread);
+	Registry.RegisterCommand(TEXT("ms_apply_moves"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPMinesweeperCommands::HandleApplyMoves), EMCPCommandThread::AnyThread);
+	Registry.RegisterCommand(TEXT("ms_get_board"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPMinesweeperCommands::HandleGetBoard), EMCPCommandThread::AnyThread);
+	Registry.RegisterCommand(TEXT("ms_end_game"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPMinesweeperCommands::HandleEndGame), EMCPCommandThread::AnyThread);
+}
+
+void FUnrealMCPMinesweeperCommands::Unregister()
+{
+	// Also waits for handlers still running on task graph workers, which hold this instance
+	FUnrealMCPCommandRegistry::Get().UnregisterAll(this);
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPMinesweeperCommands::HandleNewGame(const TSharedPtr<FJsonObject>& Params)
+{
+	using namespace MinesweeperMCP;
+
+	int32 Width = 0;
+	int32 Height = 0;
+	int32 Mines = 0;
+	if (!Params->TryGetNumberField(TEXT("width"), Width) || !Params->TryGetNumberField(TEXT("height"), Height))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'width' or 'height' parameter"));
+	}
+	if (!Params->TryGetNumberField(TEXT("mines"), Mines))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'mines' parameter"));
+	}
+	if (Width < 1 || Height < 1 || Width > MaxBoardSize || Height > MaxBoardSize || Width * Height < 2)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Board size must be between 1 and %d with at least 2 tiles"), MaxBoardSize));
+	}
+
+	// Omitting the seed gives a fresh game, passing it replays the exact same layout.
+	// FMath::Rand shares unguarded state, and this may run on several workers at once
+	int32 Seed = 0;
+	if (!Params->TryGetNumberField(TEXT("seed"), Seed))
+	{
+		Seed = int32(FPlatformTime::Cycles());
+	}
+
+	const FMinesweeperSessionId Id = Sessions->CreateSession(Width, Height, Mines, Seed);
+	if (Id == 0)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Too many open sessions, end finished ones with ms_end_game"));
+	}
+
+	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+	ResultObj->SetNumberField(TEXT("session_id"), double(Id));
+	ResultObj->SetNumberField(TEXT("width"), Width);
+	ResultObj->SetNumberField(TEXT("height"), Height);
+	ResultObj->SetNumberField(TEXT("mines"), FMath::Clamp(Mines, 1, Width * Height - 1));
+	ResultObj->SetNumberField(TEXT("seed"), Seed);
+	return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPMinesweeperCommands::HandleApplyMoves(const TSharedPtr<FJsonObject>& Params)
+{
+	using namespace MinesweeperMCP;
+
+	FMinesweeperSessionId Id = 0;
+	if (!GetSessionId(Params, Id))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'session_id' parameter"));
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* MovesJson = nullptr;
+	if (!Params->TryGetArrayField(TEXT("moves"), MovesJson))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'moves' parameter"));
+	}
+
+	// Parse the whole batch up front so a malformed move rejects it before anything is played
+	TArray<FMinesweeperMove> Moves;
+	Moves.Reserve(MovesJson->Num());
+	for (int32 MoveIndex = 0; MoveIndex < MovesJson->Num(); MoveIndex++)
+	{
+		const TSharedPtr<FJsonObject>* MoveJson = nullptr;
+		FString Op;
+		FMinesweeperMove& Move = Moves.AddDefaulted_GetRef();
+		if (!(*MovesJson)[MoveIndex]->TryGetObject(MoveJson)
+			|| !(*MoveJson)->TryGetStringField(TEXT("op"), Op)
+			|| !ParseMoveType(Op, Move.Type)
+			|| !(*MoveJson)->TryGetNumberField(TEXT("x"), Move.X)
+			|| !(*MoveJson)->TryGetNumberField(TEXT("y"), Move.Y))
+		{
+			return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Move %d must be {\"op\": \"reveal\"|\"flag\"|\"chord\", \"x\": int, \"y\": int}"), MoveIndex));
+		}
+	}
+
+	const FMinesweeperMoveBatchResult Result = Sessions->ApplyMoves(Id, MoveTemp(Moves)).GetResult();
+	if (!Result.bSessionFound)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown session: %llu"), Id));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> RevealedJson;
+	RevealedJson.Reserve(Result.Revealed.Num());
+	for (int32 Index : Result.Revealed)
+	{
+		RevealedJson.Add(MakeShared<FJsonValueNumber>(Index));
+	}
+
+	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+	ResultObj->SetNumberField(TEXT("moves_applied"), Result.MovesApplied);
+	ResultObj->SetStringField(TEXT("status"), GetStatusName(Result.Status));
+	ResultObj->SetArrayField(TEXT("revealed"), RevealedJson);
+	return ResultObj;
+}
+
+/**
+ * The board is sent as one nibble per cell, row-major, two cells per byte with the
+ * first cell in the low nibble, then base64 encoded. Codes: 0-8 revealed number,
+ * 9 hidden, 10 flagged, 11 the bomb that was hit, 12 a bomb uncovered when the game ended.
+ */
+TSharedPtr<FJsonObject> FUnrealMCPMinesweeperCommands::HandleGetBoard(const TSharedPtr<FJsonObject>& Params)
+{
+	using namespace MinesweeperMCP;
+
+	FMinesweeperSessionId Id = 0;
+	if (!GetSessionId(Params, Id))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'session_id' parameter"));
+	}
+
+	// Read on the session's shard so the snapshot never sees half of a move batch
+	const FBoardSnapshot Snapshot = Sessions->Execute(Id, [](FMinesweeperBoard* Board)
+	{
+		FBoardSnapshot Result;
+		if (!Board)
+		{
+			return Result;
+		}
+
+		Result.bSessionFound = true;
+		Result.Width = Board->GetWidth();
+		Result.Height = Board->GetHeight();
+		Result.BombCount = Board->GetBombCount();
+		Result.FlagCount = Board->GetFlagCount();
+		Result.RevealedCount = Board->GetRevealedCount();
+		Result.Status = Board->GetStatus();
+
+		const int32 NumTiles = Board->GetNumTiles();
+		Result.PackedCells.SetNumZeroed((NumTiles + 1) / 2);
+		for (int32 Index = 0; Index < NumTiles; Index++)
+		{
+			Result.PackedCells[Index >> 1] |= GetCellCode(*Board, Index) << ((Index & 1) * 4);
+		}
+		return Result;
+	}).GetResult();
+
+	if (!Snapshot.bSessionFound)
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown session: %llu"), Id));
+	}
+
+	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+	ResultObj->SetNumberField(TEXT("width"), Snapshot.Width);
+	ResultObj->SetNumberField(TEXT("height"), Snapshot.Height);
+	ResultObj->SetNumberField(TEXT("mines"), Snapshot.BombCount);
+	ResultObj->SetNumberField(TEXT("flags"), Snapshot.FlagCount);
+	ResultObj->SetNumberField(TEXT("revealed"), Snapshot.RevealedCount);
+	ResultObj->SetStringField(TEXT("status"), GetStatusName(Snapshot.Status));
+	ResultObj->SetStringField(TEXT("encoding"), TEXT("nibble_base64"));
+	ResultObj->SetStringField(TEXT("cells"), FBase64::Encode(Snapshot.PackedCells));
+	return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPMinesweeperCommands::HandleEndGame(const TSharedPtr<FJsonObject>& Params)
+{
+	FMinesweeperSessionId Id = 0;
+	if (!MinesweeperMCP::GetSessionId(Params, Id))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'session_id' parameter"));
+	}
+
+	if (!Sessions->DestroySession(Id))
+	{
+		return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown session: %llu"), Id));
+	}
+
+	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+	ResultObj->SetNumberField(TEXT("session_id"), double(Id));
+	return ResultObj;
+}
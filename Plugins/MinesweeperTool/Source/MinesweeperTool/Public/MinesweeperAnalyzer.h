@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Async/Future.h"
+#include "MinesweeperBoardAnalyzer.h"
+
+/**
+ * Batch seed analyser shown in its own tab next to the game.
+ * Runs FMinesweeperBoardAnalyzer::AnalyzeSeeds off the Slate thread and lists the results in a sortable table.
+ */
+class MINESWEEPERTOOL_API SMinesweeperAnalyzer : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SMinesweeperAnalyzer) {}
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+    virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+private:
+    typedef TSharedPtr<FMinesweeperBoardStats> FStatsPtr;
+
+    void StartAnalysis();
+    TSharedRef<ITableRow> OnGenerateRow(FStatsPtr Item, const TSharedRef<STableViewBase>& OwnerTable);
+
+    EColumnSortMode::Type GetColumnSortMode(FName ColumnId) const;
+    void OnSortColumn(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type NewSortMode);
+    void SortRows();
+
+    TArray<FStatsPtr> Rows;
+    TSharedPtr<SListView<FStatsPtr>> ListView;
+
+    FName SortColumn;
+    EColumnSortMode::Type SortMode = EColumnSortMode::None;
+
+    TFuture<TArray<FMinesweeperBoardStats>> PendingResults;
+    double AnalysisStartTime = 0.0;
+
+    TSharedPtr<class SEditableTextBox> WidthInput;
+    TSharedPtr<class SEditableTextBox> HeightInput;
+    TSharedPtr<class SEditableTextBox> BombCountInput;
+    TSharedPtr<class SEditableTextBox> FirstSeedInput;
+    TSharedPtr<class SEditableTextBox> SeedCountInput;
+    TSharedPtr<class STextBlock> StatusText;
+};
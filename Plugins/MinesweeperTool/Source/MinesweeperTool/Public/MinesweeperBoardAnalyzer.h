@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MinesweeperBoardFwd.h"
+
+/** Difficulty metrics of one generated board */
+struct FMinesweeperBoardStats
+{
+	int32 Seed = 0;
+
+	/** Minimum number of clicks needed to clear the board without flagging (Bechtel's Board Benchmark Value) */
+	int32 ThreeBV = 0;
+
+	/** Connected regions of zero tiles, each cleared by a single click */
+	int32 Openings = 0;
+
+	/** Numbered tiles that no opening reveals and need their own click */
+	int32 IsolatedNumbers = 0;
+
+	/** Times the deterministic solver got stuck and had to guess, not counting the first click */
+	int32 Guesses = 0;
+
+	/** Tile the solver replay opened with: the first opening in scan order, or the first safe number without one */
+	int32 FirstClick = INDEX_NONE;
+};
+
+/**
+ * Offline difficulty analysis used to curate seeds for level packs.
+ */
+class MINESWEEPERTOOL_API FMinesweeperBoardAnalyzer
+{
+public:
+	/** Labels openings in one pass over the adjacency array, then replays the board with FMinesweeperSolver */
+	static FMinesweeperBoardStats Analyze(const FMinesweeperBoard& Board, int32 Seed = 0);
+
+	/** Generates and analyses NumSeeds consecutive seeds with ParallelFor; OutStats is in seed order */
+	static void AnalyzeSeeds(int32 Width, int32 Height, int32 BombCount, int32 FirstSeed, int32 NumSeeds, TArray<FMinesweeperBoardStats>& OutStats);
+
+private:
+	static int32 CountSolverGuesses(const FMinesweeperBoard& Board, int32 FirstClick);
+};
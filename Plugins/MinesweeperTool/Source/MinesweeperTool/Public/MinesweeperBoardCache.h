@@ -0,0 +1,132 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "HAL/CriticalSection.h"
+#include "Math/RandomStream.h"
+#include "MinesweeperBoard.h"
+
+enum class EMinesweeperBoardMode : uint8
+{
+	/** Any layout the seed produces, the player picks the first tile */
+	Random,
+
+	/** Only layouts FMinesweeperSolver clears from a known start tile without guessing */
+	NoGuess
+};
+
+struct FMinesweeperBoardCacheKey
+{
+	int32 Width = 0;
+	int32 Height = 0;
+	int32 BombCount = 0;
+	EMinesweeperBoardMode Mode = EMinesweeperBoardMode::Random;
+
+	bool operator==(const FMinesweeperBoardCacheKey& Other) const
+	{
+		return Width == Other.Width && Height == Other.Height && BombCount == Other.BombCount && Mode == Other.Mode;
+	}
+};
+
+/** A ready board is fully described by its seed, the layout is regenerated from it on demand */
+struct FMinesweeperCachedBoard
+{
+	int32 Seed = 0;
+
+	/** Tile the game opens with so the rest can be deduced, INDEX_NONE in Random mode */
+	int32 StartIndex = INDEX_NONE;
+};
+
+struct FMinesweeperGeneratedBoard
+{
+	/** Null if generation was cancelled or no guess-free layout turned up */
+	TSharedPtr<FMinesweeperBoard> Board;
+	int32 StartIndex = INDEX_NONE;
+};
+
+/**
+ * Bounded pool of ready-to-play seeds per board configuration. Taking a board
+ * is instant; a thread pool task then tops the pool back up, which is where the
+ * expensive no-guess search happens. Only seeds and start tiles are kept, and
+ * they are persisted as compact binary so pools survive editor restarts.
+ * Random boards cost no more to generate than to rebuild from a seed, so only
+ * NoGuess configurations are cached.
+ */
+class MINESWEEPERTOOL_API FMinesweeperBoardCache
+{
+public:
+	/** Boards kept ready per configuration */
+	static constexpr int32 BoardsPerKey = 8;
+
+	/** Configurations kept warm, the least recently used one is dropped beyond this */
+	static constexpr int32 MaxKeys = 8;
+
+	/** Seeds tried per no-guess board before giving up, expert density needs about a thousand */
+	static constexpr int32 MaxNoGuessAttempts = 100000;
+
+	/** Board sides the game widget can create, keys outside them in the file are dropped on load */
+	static constexpr int32 MinBoardSize = 5;
+	static constexpr int32 MaxBoardSize = 512;
+
+	/** True if Key is worth caching: a NoGuess board with sides within the limits and at least one safe tile */
+	static bool IsValidKey(const FMinesweeperBoardCacheKey& Key);
+
+	/** Loads FilePath if it exists and starts filling the classic presets */
+	explicit FMinesweeperBoardCache(const FString& InFilePath);
+
+	/** Stops the refill task and saves the pools */
+	~FMinesweeperBoardCache();
+
+	/**
+	 * Moves a ready board for Key into OutBoard. Either way Key becomes the most
+	 * recently used configuration and the refill task is kicked, unless Key is not
+	 * valid, in which case nothing is cached and this returns false. Game thread or any other.
+	 */
+	bool Take(const FMinesweeperBoardCacheKey& Key, FMinesweeperCachedBoard& OutBoard);
+
+	/** Makes Key a configuration worth keeping warm without taking anything from it */
+	void Prewarm(const FMinesweeperBoardCacheKey& Key);
+
+	int32 GetNumReady(const FMinesweeperBoardCacheKey& Key) const;
+
+	/**
+	 * Searches for a board satisfying Key starting at FirstSeed; NoGuess mode walks
+	 * consecutive seeds and runs the solver on each. Safe to call off the game thread.
+	 */
+	static FMinesweeperGeneratedBoard Generate(const FMinesweeperBoardCacheKey& Key, int32 FirstSeed, FMinesweeperGenerationControl* Control = nullptr, FMinesweeperCachedBoard* OutCached = nullptr);
+
+	/** Lays a cached board out again from its seed. As slow as a random generation, so large boards belong off the game thread */
+	static FMinesweeperGeneratedBoard Rebuild(const FMinesweeperBoardCacheKey& Key, const FMinesweeperCachedBoard& Cached, FMinesweeperGenerationControl* Control = nullptr);
+
+	bool Save() const;
+
+private:
+	struct FPool
+	{
+		FMinesweeperBoardCacheKey Key;
+		TArray<FMinesweeperCachedBoard> Boards;
+	};
+
+	bool Load();
+
+	/** Returns the pool for Key, moved to the back as most recently used. Lock must be held */
+	FPool& TouchPool(const FMinesweeperBoardCacheKey& Key);
+
+	/** Starts the refill task unless it is already running. Lock must be held */
+	void KickRefill();
+	void Refill();
+
+	FString FilePath;
+
+	mutable FCriticalSection Lock;
+
+	// Least recently used first
+	TArray<FPool> Pools;
+	FRandomStream SeedSource;
+
+	bool bRefilling = false;
+	TFuture<void> RefillTask;
+
+	// Only its cancel flag is used, raised when the cache is destroyed
+	FMinesweeperGenerationControl RefillControl;
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** What a cell looks like. 0-8 are revealed tiles showing their adjacent bomb count */
+enum class EMinesweeperCellVisual : uint8
+{
+	Hidden = 9,
+	Flagged,
+	Exploded,
+	Bomb,
+	WonBomb,
+	WrongFlag,
+	Num
+};
+
+/**
+ * CPU side picture of a board: one CellSize x CellSize block of texels per cell,
+ * copied from a glyph atlas built for that cell size. Changed cells are tracked
+ * per row so only those spans have to be uploaded to a texture. Needs no RHI, so
+ * it also runs headless and can be validated without a GPU.
+ */
+class MINESWEEPERTOOL_API FMinesweeperBoardImage
+{
+public:
+	/** Largest texture side the image aims for, cells shrink below 16 texels to stay under it */
+	static constexpr int32 MaxImageSize = 4096;
+
+	FMinesweeperBoardImage(int32 InBoardWidth, int32 InBoardHeight);
+
+	/** Returns true if the cell changed, marking it dirty */
+	bool SetCell(int32 X, int32 Y, EMinesweeperCellVisual Visual);
+	EMinesweeperCellVisual GetCell(int32 X, int32 Y) const { return EMinesweeperCellVisual(CellVisuals[Y * BoardWidth + X]); }
+
+	static EMinesweeperCellVisual GetNumberVisual(int32 AdjacentBombs) { return EMinesweeperCellVisual(FMath::Clamp(AdjacentBombs, 0, 8)); }
+
+	/**
+	 * Moves the texel rectangles changed since the last call into OutRegions.
+	 * Runs of dirty cells on the same row become one rectangle, and identical
+	 * runs on consecutive rows are merged.
+	 */
+	void ConsumeDirtyRegions(TArray<FIntRect>& OutRegions);
+
+	/** Marks the whole image dirty, e.g. after the texture it feeds was recreated */
+	void MarkAllDirty();
+
+	int32 GetBoardWidth() const { return BoardWidth; }
+	int32 GetBoardHeight() const { return BoardHeight; }
+	int32 GetCellSize() const { return CellSize; }
+	int32 GetImageWidth() const { return BoardWidth * CellSize; }
+	int32 GetImageHeight() const { return BoardHeight * CellSize; }
+
+	/** Row-major BGRA texels, GetImageWidth() per row */
+	const TArray<FColor>& GetPixels() const { return Pixels; }
+
+	SIZE_T GetAllocatedSize() const { return CellVisuals.GetAllocatedSize() + Pixels.GetAllocatedSize() + Atlas.GetAllocatedSize() + DirtySpans.GetAllocatedSize() + DirtyRows.GetAllocatedSize(); }
+
+private:
+	void BuildAtlas();
+	void BlitCell(int32 X, int32 Y);
+
+	int32 BoardWidth;
+	int32 BoardHeight;
+	int32 CellSize;
+
+	TArray<uint8> CellVisuals;
+	TArray<FColor> Pixels;
+
+	/** One CellSize x CellSize block per EMinesweeperCellVisual */
+	TArray<FColor> Atlas;
+
+	// Dirty cell span of each board row as (MinX, MaxX), MinX is INDEX_NONE for clean rows
+	TArray<FIntPoint> DirtySpans;
+	TArray<int32> DirtyRows;
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MinesweeperBoard.h"
+
+/**
+ * Mip pyramid of per-block revealed and flagged counts. Level 0 holds single
+ * cells, every level above halves both dimensions, and the top level is one
+ * block covering the whole board. Changing a cell walks one block per level,
+ * so updates are O(log N) and a board-wide total never rescans the cells.
+ */
+class MINESWEEPERTOOL_API FMinesweeperBoardSummary
+{
+public:
+	struct FCounts
+	{
+		int32 Revealed = 0;
+		int32 Flagged = 0;
+	};
+
+	FMinesweeperBoardSummary(int32 InWidth, int32 InHeight);
+
+	void SetCellState(int32 X, int32 Y, EMinesweeperCellState NewState);
+
+	int32 GetNumLevels() const { return Levels.Num(); }
+
+	/** Size of a level in blocks */
+	FIntPoint GetLevelSize(int32 Level) const { return Levels[Level].Size; }
+
+	/** Cells covered by one block side at this level */
+	int32 GetBlockSize(int32 Level) const { return 1 << Level; }
+
+	const FCounts& GetBlock(int32 Level, int32 BlockX, int32 BlockY) const { return Levels[Level].Blocks[BlockY * Levels[Level].Size.X + BlockX]; }
+
+	/** Number of board cells inside a block, smaller than BlockSize^2 along the right and bottom edges */
+	int32 GetBlockArea(int32 Level, int32 BlockX, int32 BlockY) const;
+
+	/** Coarsest detail first: the lowest level whose blocks fit in MaxBlocks along both axes */
+	int32 FindLevelForSize(int32 MaxBlocks) const;
+
+	const FCounts& GetTotals() const { return Levels.Last().Blocks[0]; }
+
+	int32 GetWidth() const { return Width; }
+	int32 GetHeight() const { return Height; }
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FLevel
+	{
+		FIntPoint Size;
+		TArray<FCounts> Blocks;
+	};
+
+	int32 Width;
+	int32 Height;
+	TArray<FLevel> Levels;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "MinesweeperBoardFwd.h"
+
+/** Power-of-two latency buckets in microseconds: bucket N counts moves that took [2^(N-1), 2^N) us */
+struct FMinesweeperLatencyHistogram
+{
+	static constexpr int32 NumBuckets = 32;
+
+	int64 Buckets[NumBuckets] = {};
+	int64 Count = 0;
+
+	void Add(double Seconds);
+	void Append(const FMinesweeperLatencyHistogram& Other);
+
+	/** Upper bound of the bucket holding the given percentile, in microseconds */
+	double GetPercentileMicroseconds(double Percentile) const;
+};
+
+struct FMinesweeperBotResult
+{
+	bool bWon = false;
+	int32 Moves = 0;
+	int32 Guesses = 0;
+};
+
+/**
+ * Plays a board end to end through the public play API of FMinesweeperBoard.
+ * Deterministic deductions come first; when those run dry it guesses the tile
+ * with the lowest estimated bomb probability.
+ */
+class MINESWEEPERTOOL_API FMinesweeperBot
+{
+public:
+	explicit FMinesweeperBot(int32 Seed);
+
+	/** Plays until the board is won or lost. Each move is timed into Histogram when given */
+	FMinesweeperBotResult Play(FMinesweeperBoard& Board, FMinesweeperLatencyHistogram* Histogram = nullptr);
+
+private:
+	int32 PickGuess(const FMinesweeperBoard& Board, const class FMinesweeperSolver& Solver);
+
+	FRandomStream Random;
+};
+
+struct FMinesweeperBotHarnessSettings
+{
+	int32 NumGames = 1000;
+	int32 Width = 30;
+	int32 Height = 16;
+	int32 BombCount = 99;
+	int32 FirstSeed = 0;
+};
+
+struct FMinesweeperBotHarnessReport
+{
+	int32 Games = 0;
+	int32 Wins = 0;
+	int64 Moves = 0;
+	double WallSeconds = 0.0;
+	FMinesweeperLatencyHistogram MoveLatency;
+
+	double GetGamesPerSecond() const { return WallSeconds > 0.0 ? Games / WallSeconds : 0.0; }
+	double GetMovesPerSecond() const { return WallSeconds > 0.0 ? Moves / WallSeconds : 0.0; }
+	double GetWinRate() const { return Games > 0 ? double(Wins) / Games : 0.0; }
+
+	FString ToString() const;
+};
+
+/**
+ * Plays many seeded games across all cores. Doubles as a load generator for
+ * engine optimisations and as a check that faster code still plays correctly.
+ * Run it from the console with Minesweeper.BotBench [Games] [Width] [Height] [Bombs] [FirstSeed].
+ */
+class MINESWEEPERTOOL_API FMinesweeperBotHarness
+{
+public:
+	static FMinesweeperBotHarnessReport Run(const FMinesweeperBotHarnessSettings& Settings);
+};
@@ -2,9 +2,18 @@
 
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
+#include "Async/Future.h"
+#include "MinesweeperBoardFwd.h"
+#include "MinesweeperBoardCache.h"
 
 // Forward declarations
 class SMinesweeperTile;
+class FMinesweeperGameWorker;
+class FMinesweeperBoardImage;
+class FMinesweeperBoardTexture;
+class FMinesweeperBoardSummary;
+class SMinesweeperMinimap;
+struct FMinesweeperGenerationControl;
 enum class ETileState : uint8;
 
 class MINESWEEPERTOOL_API SMinesweeperGame : public SCompoundWidget
@@ -13,12 +22,20 @@ public:
     SLATE_BEGIN_ARGS(SMinesweeperGame) {}
     SLATE_END_ARGS()
 
+    virtual ~SMinesweeperGame();
+
     void Construct(const FArguments& InArgs);
+    virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
 
     // Game functions
     void InitializeGame(int32 InWidth, int32 InHeight, int32 InBombCount);
+
+    /** Queues the reveal on the game worker, the tiles update from Tick once it has been played. Revealed numbers are chorded */
     void RevealTile(int32 X, int32 Y);
     void RevealAdjacentTiles(int32 X, int32 Y);
+
+    /** Queues a flag toggle on the game worker, like RevealTile the tile only changes once the delta comes back */
+    void ToggleFlag(int32 X, int32 Y);
     void RevealAdjacentTilesImmediate(int32 X, int32 Y);
     void GameOver(bool bWon);
     void ResetGame();
@@ -26,9 +43,46 @@ public:
     // Helper functions
     int32 CountAdjacentBombs(int32 X, int32 Y) const;
     bool IsValidTile(int32 X, int32 Y) const;
+    int32 GetMaxBoardSize() const;
+
+    // Board generation runs on the thread pool; the grid is attached from Tick once it is ready
+    bool IsGenerating() const { return PendingBoard.IsValid(); }
+    bool IsGameOver() const { return bGameOver; }
+    void CancelGeneration();
 
 private:
+    void AttachBoard(const FMinesweeperGeneratedBoard& NewBoard);
+    void BuildGrid(const TSharedRef<FMinesweeperBoard>& NewBoard);
+    void BuildImage();
+    void DrainWorkerDeltas();
+    bool IsTileRevealed(int32 X, int32 Y) const;
+    FReply OnBoardImageClicked(const FGeometry& Geometry, const FPointerEvent& MouseEvent);
+    FBox2D GetMinimapViewRect() const;
+    int64 GetBoardMemory() const;
+    void JumpTo(FVector2D BoardFraction);
+
+    TSharedPtr<FMinesweeperBoard> Board;
+    TFuture<FMinesweeperGeneratedBoard> PendingBoard;
+    TSharedPtr<FMinesweeperGenerationControl> PendingControl;
+
+    // Owns play state once a board is attached; Board above is only read for its layout
+    TUniquePtr<FMinesweeperGameWorker> Worker;
+
     TArray<TArray<TSharedPtr<SMinesweeperTile>>> Grid;
+
+    // Texture view: the whole board is one image instead of a widget per tile. Takes effect on the next game
+    bool bUseTextureView = false;
+    TUniquePtr<FMinesweeperBoardImage> BoardImage;
+    TUniquePtr<FMinesweeperBoardTexture> BoardTexture;
+
+    // Deal only boards the solver clears from their start tile. Takes effect on the next game
+    bool bNoGuess = false;
+
+    bool bShowTelemetry = false;
+
+    // Revealed/flagged counts per block for the minimap, updated alongside the tiles
+    TSharedPtr<FMinesweeperBoardSummary> Summary;
+    TSharedPtr<SMinesweeperMinimap> Minimap;
     int32 Width;
     int32 Height;
     int32 BombCount;
@@ -41,6 +95,7 @@ private:
     TSharedPtr<class SButton> StartButton;
 
     TSharedPtr<SScrollBox> ScrollBox;
+    TSharedPtr<SScrollBox> HorizontalScrollBox;
     TSharedPtr<SBox> ContentBox;
 
     TSharedPtr<class STextBlock> GameStatusText;
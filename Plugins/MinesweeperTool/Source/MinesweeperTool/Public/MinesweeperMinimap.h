@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class FMinesweeperBoardSummary;
+
+/** Fired with the clicked point as a fraction of the board, (0,0) top left and (1,1) bottom right */
+DECLARE_DELEGATE_OneParam(FOnMinesweeperMinimapJump, FVector2D);
+
+/**
+ * Overview of the whole board drawn from one level of an FMinesweeperBoardSummary,
+ * shading each block by its revealed, flagged and unknown share. The mouse wheel
+ * steps between pyramid levels; clicking reports where to jump the main view to.
+ */
+class MINESWEEPERTOOL_API SMinesweeperMinimap : public SLeafWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SMinesweeperMinimap) {}
+        /** Visible part of the board in board fractions, drawn as an outline */
+        SLATE_ATTRIBUTE(FBox2D, ViewRect)
+        SLATE_EVENT(FOnMinesweeperMinimapJump, OnJump)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+
+    void SetSummary(TSharedPtr<const FMinesweeperBoardSummary> InSummary);
+
+    // SWidget interface
+    virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+    virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+    virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+private:
+    int32 GetDisplayLevel() const;
+
+    /** Local units per board cell, the same on both axes so the board keeps its aspect */
+    float GetCellScale(const FGeometry& Geometry) const;
+
+    TSharedPtr<const FMinesweeperBoardSummary> Summary;
+    TAttribute<FBox2D> ViewRect;
+    FOnMinesweeperMinimapJump OnJump;
+
+    /** How many levels finer than the default overview the map is zoomed in */
+    int32 ZoomSteps = 0;
+};
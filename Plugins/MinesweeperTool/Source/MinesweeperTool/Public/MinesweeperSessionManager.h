@@ -0,0 +1,135 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Pipe.h"
+#include "Misc/ScopeRWLock.h"
+#include "HAL/PlatformTime.h"
+#include <atomic>
+#include "MinesweeperBoard.h"
+
+typedef uint64 FMinesweeperSessionId;
+
+enum class EMinesweeperMoveType : uint8
+{
+	Reveal,
+	Flag,
+	Chord
+};
+
+struct FMinesweeperMove
+{
+	EMinesweeperMoveType Type = EMinesweeperMoveType::Reveal;
+	int32 X = 0;
+	int32 Y = 0;
+};
+
+struct FMinesweeperMoveBatchResult
+{
+	bool bSessionFound = false;
+	int32 MovesApplied = 0;
+	EMinesweeperGameStatus Status = EMinesweeperGameStatus::Playing;
+
+	/** Every tile revealed by the batch, in reveal order */
+	TArray<int32> Revealed;
+};
+
+/**
+ * Free lists of boards per size, so creating and destroying thousands of
+ * sessions does not hit the allocator for every game.
+ */
+class MINESWEEPERTOOL_API FMinesweeperBoardPool
+{
+public:
+	explicit FMinesweeperBoardPool(int32 InMaxPooledBoards = 4096);
+
+	TUniquePtr<FMinesweeperBoard> Acquire(int32 Width, int32 Height);
+	void Release(TUniquePtr<FMinesweeperBoard> Board);
+
+private:
+	FCriticalSection Lock;
+	TMap<FIntPoint, TArray<TUniquePtr<FMinesweeperBoard>>> FreeBoards;
+	int32 NumPooled = 0;
+	int32 MaxPooledBoards;
+};
+
+/**
+ * Hosts many independent boards at once for bots, tournaments and scripted tests.
+ * Sessions are spread over a fixed set of task pipes by id. Work on one session
+ * always runs on the same pipe, so it is serialised without any per-board locks,
+ * while different shards run in parallel on the task graph workers.
+ *
+ * At most MaxSessions boards are kept. Once full, creating a session first drops
+ * those nobody has touched for IdleTimeoutSeconds, such as games abandoned by a
+ * client that disconnected, and fails if none is that old.
+ */
+class MINESWEEPERTOOL_API FMinesweeperSessionManager
+{
+public:
+	/** NumShards <= 0 picks one shard per task graph worker */
+	explicit FMinesweeperSessionManager(int32 NumShards = 0, int32 InMaxSessions = 1024, double InIdleTimeoutSeconds = 600.0);
+	~FMinesweeperSessionManager();
+
+	/** Returns 0 if MaxSessions are open and none has been idle long enough to evict */
+	FMinesweeperSessionId CreateSession(int32 Width, int32 Height, int32 BombCount, int32 Seed);
+
+	/** Removes the session; work already queued for it still completes first */
+	bool DestroySession(FMinesweeperSessionId Id);
+
+	int32 GetNumSessions() const;
+
+	/**
+	 * Runs Function(FMinesweeperBoard*) on the session's shard, after any earlier work for it.
+	 * The board pointer is null if the session does not exist.
+	 */
+	template <typename FunctionType>
+	auto Execute(FMinesweeperSessionId Id, FunctionType&& Function) -> UE::Tasks::TTask<decltype(Function(nullptr))>
+	{
+		FReadScopeLock ReadLock(SessionsLock);
+
+		// Launching while the lock is held orders this task before any release queued by DestroySession
+		if (const TUniquePtr<FSession>* Session = Sessions.Find(Id))
+		{
+			(*Session)->LastUsedSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+			FMinesweeperBoard* Board = (*Session)->Board.Get();
+			return GetShard(Id).Launch(TEXT("MinesweeperSessionTask"),
+				[Board, Function = Forward<FunctionType>(Function)]() mutable { return Function(Board); });
+		}
+
+		return UE::Tasks::Launch(TEXT("MinesweeperSessionTask"),
+			[Function = Forward<FunctionType>(Function)]() mutable { return Function(nullptr); });
+	}
+
+	/** Applies the moves in order, stopping early once the game is over */
+	UE::Tasks::TTask<FMinesweeperMoveBatchResult> ApplyMoves(FMinesweeperSessionId Id, TArray<FMinesweeperMove> Moves);
+
+	/** Blocks until every shard has drained */
+	void Flush();
+
+private:
+	struct FSession
+	{
+		TUniquePtr<FMinesweeperBoard> Board;
+
+		/** When work was last queued for the session, stored under the read lock */
+		std::atomic<double> LastUsedSeconds;
+	};
+
+	UE::Tasks::FPipe& GetShard(FMinesweeperSessionId Id) { return *Shards[Id % Shards.Num()]; }
+
+	/** Hands the board back to the pool once the session's queued work is done. Write lock must be held */
+	void ReleaseSession(FMinesweeperSessionId Id, TUniquePtr<FSession> Session);
+
+	/** Drops every session idle since before IdleBefore. Write lock must be held */
+	void EvictIdleSessions(double IdleBefore);
+
+	TArray<TUniquePtr<UE::Tasks::FPipe>> Shards;
+
+	mutable FRWLock SessionsLock;
+	TMap<FMinesweeperSessionId, TUniquePtr<FSession>> Sessions;
+	FMinesweeperSessionId NextSessionId = 1;
+
+	int32 MaxSessions;
+	double IdleTimeoutSeconds;
+
+	FMinesweeperBoardPool BoardPool;
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Deterministic single-point deduction over what a player can see.
+ * The solver never looks at bomb positions: callers feed it revealed numbers
+ * through OnRevealed and it reports tiles that are provably safe.
+ */
+class MINESWEEPERTOOL_API FMinesweeperSolver
+{
+public:
+	enum class EKnowledge : uint8
+	{
+		Unknown,
+		Safe,
+		Mine,
+		Revealed
+	};
+
+	FMinesweeperSolver(int32 InWidth, int32 InHeight);
+
+	/** Records a revealed number and queues it and its revealed neighbours for another look */
+	void OnRevealed(int32 Index, int32 AdjacentBombs);
+
+	/**
+	 * Drains the queue of tiles whose neighbourhood changed and appends every tile
+	 * proven safe to OutSafe. Proven mines are remembered internally.
+	 * Returns true if anything new was deduced.
+	 */
+	bool Deduce(TArray<int32>& OutSafe);
+
+	EKnowledge GetKnowledge(int32 Index) const { return Knowledge[Index]; }
+	int32 GetNumber(int32 Index) const { return Numbers[Index]; }
+	int32 GetKnownMineCount() const { return KnownMines; }
+	int32 GetWidth() const { return Width; }
+	int32 GetHeight() const { return Height; }
+
+	/** Calls Visit(NeighbourIndex) for each of the up to 8 tiles around Index */
+	template <typename FunctorType>
+	void ForEachNeighbour(int32 Index, FunctorType&& Visit) const
+	{
+		const int32 X = Index % Width;
+		const int32 Y = Index / Width;
+		for (int32 NY = FMath::Max(Y - 1, 0); NY <= FMath::Min(Y + 1, Height - 1); NY++)
+		{
+			for (int32 NX = FMath::Max(X - 1, 0); NX <= FMath::Min(X + 1, Width - 1); NX++)
+			{
+				const int32 Neighbour = NY * Width + NX;
+				if (Neighbour != Index)
+				{
+					Visit(Neighbour);
+				}
+			}
+		}
+	}
+
+private:
+	void MarkDirty(int32 Index);
+	void MarkNeighboursDirty(int32 Index);
+
+	int32 Width;
+	int32 Height;
+	int32 KnownMines;
+
+	TArray<EKnowledge> Knowledge;
+	TArray<uint8> Numbers;
+
+	TArray<int32> DirtyTiles;
+	TBitArray<> IsDirty;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+enum class EMinesweeperTelemetryEvent : uint8
+{
+	/** A board laid out, including any no-guess search. Cells is the board size */
+	Generate,
+
+	/** One reveal played by the game worker. Cells is the number of tiles it opened */
+	Reveal,
+
+	/** Slate paint of the board area. Cells is unused */
+	Paint,
+
+	Num
+};
+
+struct FMinesweeperTelemetrySample
+{
+	EMinesweeperTelemetryEvent Event = EMinesweeperTelemetryEvent::Generate;
+	int32 Cells = 0;
+	double Seconds = 0.0;
+};
+
+/**
+ * Process wide rings of the most recent samples, one per event. Recording is
+ * one atomic increment and a few relaxed stores, so it can sit on engine hot
+ * paths on any thread; readers copy slots out and drop any being rewritten.
+ */
+class MINESWEEPERTOOL_API FMinesweeperTelemetry
+{
+public:
+	/** Samples kept per event */
+	static constexpr int32 Capacity = 256;
+
+	static void Record(EMinesweeperTelemetryEvent Event, int32 Cells, double Seconds);
+
+	/** Copies the samples of Event still in its ring, oldest first */
+	static void Snapshot(EMinesweeperTelemetryEvent Event, TArray<FMinesweeperTelemetrySample>& OutSamples);
+
+	/** Most recent sample of Event */
+	static bool FindLatest(EMinesweeperTelemetryEvent Event, FMinesweeperTelemetrySample& OutSample);
+};
+
+/** Records the time from construction to destruction. Set Cells before the scope closes */
+struct FMinesweeperTelemetryScope
+{
+	explicit FMinesweeperTelemetryScope(EMinesweeperTelemetryEvent InEvent, int32 InCells = 0)
+		: Event(InEvent)
+		, Cells(InCells)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FMinesweeperTelemetryScope()
+	{
+		FMinesweeperTelemetry::Record(Event, Cells, FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles));
+	}
+
+	EMinesweeperTelemetryEvent Event;
+	int32 Cells;
+	uint64 StartCycles;
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+
+/**
+ * Wraps the board area, times its Slate paint into FMinesweeperTelemetry and,
+ * while ShowStats is set, draws the latest samples in its top right corner
+ * together with the widget count of the content and the board's memory.
+ */
+class MINESWEEPERTOOL_API SMinesweeperTelemetryOverlay : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SMinesweeperTelemetryOverlay)
+        : _ShowStats(false)
+        , _BoardMemory(0)
+    {}
+        SLATE_DEFAULT_SLOT(FArguments, Content)
+        SLATE_ATTRIBUTE(bool, ShowStats)
+        /** Bytes held by the board state behind the content */
+        SLATE_ATTRIBUTE(int64, BoardMemory)
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+
+    // SWidget interface
+    virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+private:
+    FString GetStatsText() const;
+
+    TSharedPtr<SWidget> Content;
+    TAttribute<bool> ShowStats;
+    TAttribute<int64> BoardMemory;
+};
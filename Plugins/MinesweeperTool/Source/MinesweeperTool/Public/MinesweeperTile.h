@@ -8,9 +8,7 @@ enum class ETileState : uint8
 {
     Hidden,
     Revealed,
-    Bomb,
-    Flagged
-   
+    Bomb
 };
 
 class MINESWEEPERTOOL_API SMinesweeperTile : public SCompoundWidget
@@ -28,17 +26,24 @@ public:
     FReply OnTileClicked();
     FReply OnTileRightClicked();
 
+    // SWidget interface. SButton only takes the left button, so right clicks bubble up to the tile
+    virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
     void Reveal();
+    void SetFlagged(bool bInFlagged);
     void RevealAsWin();
     void ShowIncorrectFlag();
     void SetHighlight(bool bHighlight);
     bool IsRevealed() const { return State == ETileState::Revealed; }
     bool IsBomb() const { return State == ETileState::Bomb; }
-    bool IsFlagged() const { return State == ETileState::Flagged; }
+    bool IsFlagged() const { return bFlagged; }
 
 private:
     TWeakPtr<SMinesweeperGame> Game;
     ETileState State = ETileState::Hidden;
+
+    // Kept apart from State, which already tells bombs from other hidden tiles
+    bool bFlagged = false;
     int32 AdjacentBombs = 0;
 
     TAttribute<int32> X;
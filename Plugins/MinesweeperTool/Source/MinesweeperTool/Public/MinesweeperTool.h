@@ -17,15 +17,28 @@ public:
 	
 	/** This function will be bound to Command (by default it will bring up plugin window) */
 	void PluginButtonClicked();
+
+	/** Tab that hosts the seed analyser, docked next to the game window */
+	static const FName AnalyzerTabName;
+
+	/** Ready boards shared by every game tab, null while the module is not loaded */
+	static class FMinesweeperBoardCache* GetBoardCache();
 	
 private:
 
 	void RegisterMenus();
 
 	TSharedRef<class SDockTab> OnSpawnPluginTab(const class FSpawnTabArgs& SpawnTabArgs);
+	TSharedRef<class SDockTab> OnSpawnAnalyzerTab(const class FSpawnTabArgs& SpawnTabArgs);
 
 private:
 	TSharedPtr<class FUICommandList> PluginCommands;
 
 	TSharedPtr<FSlateStyleSet> StyleSet;
+
+	/** Minesweeper commands exposed through the UnrealMCP bridge */
+	TSharedPtr<class FUnrealMCPMinesweeperCommands> MCPCommands;
+
+	/** Pre-generated boards, persisted under Saved/MinesweeperTool */
+	TSharedPtr<class FMinesweeperBoardCache> BoardCache;
 };
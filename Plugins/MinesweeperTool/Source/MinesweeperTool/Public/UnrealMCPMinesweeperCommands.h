@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class FMinesweeperSessionManager;
+
+/**
+ * Handler class for Minesweeper MCP commands, registered with the MCP command registry by the MinesweeperTool module.
+ * Games are sessions in an FMinesweeperSessionManager, so agents can run many boards side by side.
+ *
+ *  ms_new_game     width, height, mines, [seed]          -> session_id
+ *  ms_apply_moves  session_id, moves: [{op, x, y}, ...]  -> moves_applied, status, revealed tile indices
+ *  ms_get_board    session_id                            -> status and the packed cells, see HandleGetBoard
+ *  ms_end_game     session_id
+ */
+class MINESWEEPERTOOL_API FUnrealMCPMinesweeperCommands
+{
+public:
+	FUnrealMCPMinesweeperCommands();
+	~FUnrealMCPMinesweeperCommands();
+
+	/** Adds every command to FUnrealMCPCommandRegistry, bound to this instance */
+	void Register();
+	void Unregister();
+
+private:
+	// Specific minesweeper command handlers
+	TSharedPtr<FJsonObject> HandleNewGame(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleApplyMoves(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleGetBoard(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleEndGame(const TSharedPtr<FJsonObject>& Params);
+
+	TUniquePtr<FMinesweeperSessionManager> Sessions;
+};
@@ -1,5 +1,6 @@
 #include "Commands/UnrealMCPBlueprintCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPCommandRegistry.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Factories/BlueprintFactory.h"
@@ -25,46 +26,16 @@ FUnrealMCPBlueprintCommands::FUnrealMCPBlueprintCommands()
 {
 }
 
-TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+void FUnrealMCPBlueprintCommands::RegisterCommands(FUnrealMCPCommandRegistry& Registry)
 {
-    if (CommandType == TEXT("create_blueprint"))
-    {
-        return HandleCreateBlueprint(Params);
-    }
-    else if (CommandType == TEXT("add_component_to_blueprint"))
-    {
-        return HandleAddComponentToBlueprint(Params);
-    }
-    else if (CommandType == TEXT("set_component_property"))
-    {
-        return HandleSetComponentProperty(Params);
-    }
-    else if (CommandType == TEXT("set_physics_properties"))
-    {
-        return HandleSetPhysicsProperties(Params);
-    }
-    else if (CommandType == TEXT("compile_blueprint"))
-    {
-        return HandleCompileBlueprint(Params);
-    }
-    else if (CommandType == TEXT("spawn_blueprint_actor"))
-    {
-        return HandleSpawnBlueprintActor(Params);
-    }
-    else if (CommandType == TEXT("set_blueprint_property"))
-    {
-        return HandleSetBlueprintProperty(Params);
-    }
-    else if (CommandType == TEXT("set_static_mesh_properties"))
-    {
-        return HandleSetStaticMeshProperties(Params);
-    }
-    else if (CommandType == TEXT("set_pawn_properties"))
-    {
-        return HandleSetPawnProperties(Params);
-    }
-    
-    return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint command: %s"), *CommandType));
+    Registry.RegisterCommand(TEXT("create_blueprint"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintCommands::HandleCreateBlueprint));
+    Registry.RegisterCommand(TEXT("add_component_to_blueprint"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintCommands::HandleAddComponentToBlueprint));
+    Registry.RegisterCommand(TEXT("set_component_property"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintCommands::HandleSetComponentProperty));
+    Registry.RegisterCommand(TEXT("set_physics_properties"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintCommands::HandleSetPhysicsProperties));
+    Registry.RegisterCommand(TEXT("compile_blueprint"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintCommands::HandleCompileBlueprint));
+    Registry.RegisterCommand(TEXT("set_blueprint_property"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintCommands::HandleSetBlueprintProperty));
+    Registry.RegisterCommand(TEXT("set_static_mesh_properties"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintCommands::HandleSetStaticMeshProperties));
+    Registry.RegisterCommand(TEXT("set_pawn_properties"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintCommands::HandleSetPawnProperties));
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintCommands::HandleCreateBlueprint(const TSharedPtr<FJsonObject>& Params)
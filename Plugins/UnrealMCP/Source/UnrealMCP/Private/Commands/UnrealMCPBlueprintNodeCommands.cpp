@@ -1,5 +1,6 @@
 #include "Commands/UnrealMCPBlueprintNodeCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPCommandRegistry.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "EdGraph/EdGraph.h"
@@ -24,42 +25,16 @@ FUnrealMCPBlueprintNodeCommands::FUnrealMCPBlueprintNodeCommands()
 {
 }
 
-TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+void FUnrealMCPBlueprintNodeCommands::RegisterCommands(FUnrealMCPCommandRegistry& Registry)
 {
-    if (CommandType == TEXT("connect_blueprint_nodes"))
-    {
-        return HandleConnectBlueprintNodes(Params);
-    }
-    else if (CommandType == TEXT("add_blueprint_get_self_component_reference"))
-    {
-        return HandleAddBlueprintGetSelfComponentReference(Params);
-    }
-    else if (CommandType == TEXT("add_blueprint_event_node"))
-    {
-        return HandleAddBlueprintEvent(Params);
-    }
-    else if (CommandType == TEXT("add_blueprint_function_node"))
-    {
-        return HandleAddBlueprintFunctionCall(Params);
-    }
-    else if (CommandType == TEXT("add_blueprint_variable"))
-    {
-        return HandleAddBlueprintVariable(Params);
-    }
-    else if (CommandType == TEXT("add_blueprint_input_action_node"))
-    {
-        return HandleAddBlueprintInputActionNode(Params);
-    }
-    else if (CommandType == TEXT("add_blueprint_self_reference"))
-    {
-        return HandleAddBlueprintSelfReference(Params);
-    }
-    else if (CommandType == TEXT("find_blueprint_nodes"))
-    {
-        return HandleFindBlueprintNodes(Params);
-    }
-    
-    return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint node command: %s"), *CommandType));
+    Registry.RegisterCommand(TEXT("connect_blueprint_nodes"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintNodeCommands::HandleConnectBlueprintNodes));
+    Registry.RegisterCommand(TEXT("add_blueprint_get_self_component_reference"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintGetSelfComponentReference));
+    Registry.RegisterCommand(TEXT("add_blueprint_event_node"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintEvent));
+    Registry.RegisterCommand(TEXT("add_blueprint_function_node"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintFunctionCall));
+    Registry.RegisterCommand(TEXT("add_blueprint_variable"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintVariable));
+    Registry.RegisterCommand(TEXT("add_blueprint_input_action_node"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintInputActionNode));
+    Registry.RegisterCommand(TEXT("add_blueprint_self_reference"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintNodeCommands::HandleAddBlueprintSelfReference));
+    Registry.RegisterCommand(TEXT("find_blueprint_nodes"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPBlueprintNodeCommands::HandleFindBlueprintNodes));
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPBlueprintNodeCommands::HandleConnectBlueprintNodes(const TSharedPtr<FJsonObject>& Params)
@@ -0,0 +1,83 @@
+#include "Commands/UnrealMCPCommandRegistry.h"
+#include "Misc/ScopeRWLock.h"
+#include "HAL/PlatformProcess.h"
+
+FUnrealMCPCommandRegistry& FUnrealMCPCommandRegistry::Get()
+{
+    // Function static, so modules loaded before the bridge subsystem can register already
+    static FUnrealMCPCommandRegistry Registry;
+    return Registry;
+}
+
+void FUnrealMCPCommandRegistry::RegisterCommand(FName CommandName, const FMCPCommandHandler& Handler, EMCPCommandThread Thread)
+{
+    check(IsInGameThread());
+
+    FWriteScopeLock WriteLock(CommandsLock);
+    if (Commands.Contains(CommandName))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UnrealMCPCommandRegistry: Command '%s' registered twice, replacing the earlier handler"), *CommandName.ToString());
+    }
+    Commands.Add(CommandName, MakeShared<const FMCPRegisteredCommand>(FMCPRegisteredCommand{ Handler, Thread }));
+}
+
+void FUnrealMCPCommandRegistry::UnregisterCommand(FName CommandName)
+{
+    check(IsInGameThread());
+
+    TArray<TSharedRef<const FMCPRegisteredCommand>> Removed;
+    {
+        FWriteScopeLock WriteLock(CommandsLock);
+        if (const TSharedRef<const FMCPRegisteredCommand>* Command = Commands.Find(CommandName))
+        {
+            Removed.Add(*Command);
+            Commands.Remove(CommandName);
+        }
+    }
+    WaitForRelease(Removed);
+}
+
+void FUnrealMCPCommandRegistry::UnregisterAll(const void* Owner)
+{
+    check(IsInGameThread());
+
+    TArray<TSharedRef<const FMCPRegisteredCommand>> Removed;
+    {
+        FWriteScopeLock WriteLock(CommandsLock);
+        for (auto It = Commands.CreateIterator(); It; ++It)
+        {
+            if (It.Value()->Handler.IsBoundToObject(Owner))
+            {
+                Removed.Add(It.Value());
+                It.RemoveCurrent();
+            }
+        }
+    }
+    WaitForRelease(Removed);
+}
+
+void FUnrealMCPCommandRegistry::WaitForRelease(const TArray<TSharedRef<const FMCPRegisteredCommand>>& Removed)
+{
+    // Thread safe commands run on task graph workers holding the command, and with it the raw
+    // pointer to their handler object. Those finish without the game thread, so waiting is safe
+    for (const TSharedRef<const FMCPRegisteredCommand>& Command : Removed)
+    {
+        while (Command.GetSharedReferenceCount() > 1)
+        {
+            FPlatformProcess::Sleep(0.001f);
+        }
+    }
+}
+
+TSharedPtr<const FMCPRegisteredCommand> FUnrealMCPCommandRegistry::FindCommand(FName CommandName) const
+{
+    FReadScopeLock ReadLock(CommandsLock);
+    const TSharedRef<const FMCPRegisteredCommand>* Command = Commands.Find(CommandName);
+    return Command ? TSharedPtr<const FMCPRegisteredCommand>(*Command) : nullptr;
+}
+
+int32 FUnrealMCPCommandRegistry::GetNumCommands() const
+{
+    FReadScopeLock ReadLock(CommandsLock);
+    return Commands.Num();
+}
@@ -1,5 +1,6 @@
 #include "Commands/UnrealMCPEditorCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPCommandRegistry.h"
 #include "Editor.h"
 #include "EditorViewportClient.h"
 #include "LevelEditorViewport.h"
@@ -25,57 +26,30 @@ FUnrealMCPEditorCommands::FUnrealMCPEditorCommands()
 {
 }
 
-TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+void FUnrealMCPEditorCommands::RegisterCommands(FUnrealMCPCommandRegistry& Registry)
 {
     // Actor manipulation commands
-    if (CommandType == TEXT("get_actors_in_level"))
-    {
-        return HandleGetActorsInLevel(Params);
-    }
-    else if (CommandType == TEXT("find_actors_by_name"))
-    {
-        return HandleFindActorsByName(Params);
-    }
-    else if (CommandType == TEXT("spawn_actor") || CommandType == TEXT("create_actor"))
-    {
-        if (CommandType == TEXT("create_actor"))
-        {
-            UE_LOG(LogTemp, Warning, TEXT("'create_actor' command is deprecated and will be removed in a future version. Please use 'spawn_actor' instead."));
-        }
-        return HandleSpawnActor(Params);
-    }
-    else if (CommandType == TEXT("delete_actor"))
-    {
-        return HandleDeleteActor(Params);
-    }
-    else if (CommandType == TEXT("set_actor_transform"))
-    {
-        return HandleSetActorTransform(Params);
-    }
-    else if (CommandType == TEXT("get_actor_properties"))
-    {
-        return HandleGetActorProperties(Params);
-    }
-    else if (CommandType == TEXT("set_actor_property"))
-    {
-        return HandleSetActorProperty(Params);
-    }
+    Registry.RegisterCommand(TEXT("get_actors_in_level"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPEditorCommands::HandleGetActorsInLevel));
+    Registry.RegisterCommand(TEXT("find_actors_by_name"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPEditorCommands::HandleFindActorsByName));
+    Registry.RegisterCommand(TEXT("spawn_actor"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPEditorCommands::HandleSpawnActor));
+    Registry.RegisterCommand(TEXT("create_actor"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPEditorCommands::HandleCreateActor));
+    Registry.RegisterCommand(TEXT("delete_actor"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPEditorCommands::HandleDeleteActor));
+    Registry.RegisterCommand(TEXT("set_actor_transform"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPEditorCommands::HandleSetActorTransform));
+    Registry.RegisterCommand(TEXT("get_actor_properties"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPEditorCommands::HandleGetActorProperties));
+    Registry.RegisterCommand(TEXT("set_actor_property"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPEditorCommands::HandleSetActorProperty));
+
     // Blueprint actor spawning
-    else if (CommandType == TEXT("spawn_blueprint_actor"))
-    {
-        return HandleSpawnBlueprintActor(Params);
-    }
+    Registry.RegisterCommand(TEXT("spawn_blueprint_actor"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPEditorCommands::HandleSpawnBlueprintActor));
+
     // Editor viewport commands
-    else if (CommandType == TEXT("focus_viewport"))
-    {
-        return HandleFocusViewport(Params);
-    }
-    else if (CommandType == TEXT("take_screenshot"))
-    {
-        return HandleTakeScreenshot(Params);
-    }
-    
-    return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown editor command: %s"), *CommandType));
+    Registry.RegisterCommand(TEXT("focus_viewport"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPEditorCommands::HandleFocusViewport));
+    Registry.RegisterCommand(TEXT("take_screenshot"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPEditorCommands::HandleTakeScreenshot));
+}
+
+TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleCreateActor(const TSharedPtr<FJsonObject>& Params)
+{
+    UE_LOG(LogTemp, Warning, TEXT("'create_actor' command is deprecated and will be removed in a future version. Please use 'spawn_actor' instead."));
+    return HandleSpawnActor(Params);
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPEditorCommands::HandleGetActorsInLevel(const TSharedPtr<FJsonObject>& Params)
@@ -1,5 +1,6 @@
 #include "Commands/UnrealMCPUMGCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
+#include "Commands/UnrealMCPCommandRegistry.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -30,34 +31,14 @@ FUnrealMCPUMGCommands::FUnrealMCPUMGCommands()
 {
 }
 
-TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleCommand(const FString& CommandName, const TSharedPtr<FJsonObject>& Params)
+void FUnrealMCPUMGCommands::RegisterCommands(FUnrealMCPCommandRegistry& Registry)
 {
-	if (CommandName == TEXT("create_umg_widget_blueprint"))
-	{
-		return HandleCreateUMGWidgetBlueprint(Params);
-	}
-	else if (CommandName == TEXT("add_text_block_to_widget"))
-	{
-		return HandleAddTextBlockToWidget(Params);
-	}
-	else if (CommandName == TEXT("add_widget_to_viewport"))
-	{
-		return HandleAddWidgetToViewport(Params);
-	}
-	else if (CommandName == TEXT("add_button_to_widget"))
-	{
-		return HandleAddButtonToWidget(Params);
-	}
-	else if (CommandName == TEXT("bind_widget_event"))
-	{
-		return HandleBindWidgetEvent(Params);
-	}
-	else if (CommandName == TEXT("set_text_block_binding"))
-	{
-		return HandleSetTextBlockBinding(Params);
-	}
-
-	return FUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown UMG command: %s"), *CommandName));
+	Registry.RegisterCommand(TEXT("create_umg_widget_blueprint"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPUMGCommands::HandleCreateUMGWidgetBlueprint));
+	Registry.RegisterCommand(TEXT("add_text_block_to_widget"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPUMGCommands::HandleAddTextBlockToWidget));
+	Registry.RegisterCommand(TEXT("add_widget_to_viewport"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPUMGCommands::HandleAddWidgetToViewport));
+	Registry.RegisterCommand(TEXT("add_button_to_widget"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPUMGCommands::HandleAddButtonToWidget));
+	Registry.RegisterCommand(TEXT("bind_widget_event"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPUMGCommands::HandleBindWidgetEvent));
+	Registry.RegisterCommand(TEXT("set_text_block_binding"), FMCPCommandHandler::CreateRaw(this, &FUnrealMCPUMGCommands::HandleSetTextBlockBinding));
 }
 
 TSharedPtr<FJsonObject> FUnrealMCPUMGCommands::HandleCreateUMGWidgetBlueprint(const TSharedPtr<FJsonObject>& Params)
@@ -0,0 +1,252 @@
+#include "MCPConnection.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Misc/ScopeLock.h"
+#include "MCPSocketPoller.h"
+
+// Smallest read from a client socket
+const int32 ReceiveChunkSize = 8192;
+
+// Most bytes taken from one client per pass, so a flood from one does not starve the others on the worker
+const int32 MaxReceivePerPass = 1024 * 1024;
+
+// Send buffer capacity kept once drained, anything above is released after a large response
+const int32 RetainedSendBufferSize = 1024 * 1024;
+
+FMCPConnection::FMCPConnection(FSocket* InSocket, int32 InId)
+    : Socket(InSocket)
+    , Id(InId)
+    , ReadOffset(0)
+    , ScanOffset(0)
+    , FrameDepth(0)
+    , bInString(false)
+    , bEscaped(false)
+    , bSkippingStray(false)
+    , SendOffset(0)
+    , RequestsInFlight(0)
+{
+    // Set socket options to improve connection stability
+    Socket->SetNonBlocking(true);
+    Socket->SetNoDelay(true);
+    int32 SocketBufferSize = 65536;  // 64KB buffer
+    Socket->SetSendBufferSize(SocketBufferSize, SocketBufferSize);
+    Socket->SetReceiveBufferSize(SocketBufferSize, SocketBufferSize);
+}
+
+FMCPConnection::~FMCPConnection()
+{
+    Socket->Close();
+    ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+}
+
+bool FMCPConnection::Receive(int32& OutBytesRead)
+{
+    OutBytesRead = 0;
+
+    // Only the frame still being scanned counts. The worker reads only once every complete
+    // message is popped, so at most one pass lies beyond the limit before it is caught
+    if (FrameDepth > 0 && ScanOffset - ReadOffset > MaxMessageSize)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPConnection: Client %d sent a message over %d bytes, disconnecting"), Id, MaxMessageSize);
+        return false;
+    }
+
+    CompactReceiveBuffer();
+
+    while (true)
+    {
+        // Read straight into the buffer's slack, growing it only when it is full
+        const int32 Offset = ReceiveBuffer.Num();
+        const int32 ReadSize = FMath::Max(ReceiveBuffer.Max() - Offset, ReceiveChunkSize);
+        ReceiveBuffer.AddUninitialized(ReadSize);
+
+        int32 BytesRead = 0;
+        const bool bRead = Socket->Recv(ReceiveBuffer.GetData() + Offset, ReadSize, BytesRead);
+        ReceiveBuffer.SetNum(Offset + FMath::Max(BytesRead, 0), EAllowShrinking::No);
+
+        // On a stream socket Recv reports would-block as success with no bytes, and both a
+        // graceful close and a real error as failure, so failure always ends the connection
+        if (!bRead)
+        {
+            const ESocketErrors LastError = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode();
+            UE_LOG(LogTemp, Display, TEXT("MCPConnection: Client %d disconnected. Last error code: %d"), Id, (int32)LastError);
+            return false;
+        }
+
+        // Nothing more to read for now, which is normal for non-blocking sockets
+        if (BytesRead == 0)
+        {
+            return true;
+        }
+
+        OutBytesRead += BytesRead;
+        if (OutBytesRead >= MaxReceivePerPass)
+        {
+            return true;
+        }
+    }
+}
+
+bool FMCPConnection::PopMessage(FString& OutMessage)
+{
+    const uint8* Data = ReceiveBuffer.GetData();
+    while (ScanOffset < ReceiveBuffer.Num())
+    {
+        const uint8 Char = Data[ScanOffset++];
+
+        // Between frames only whitespace is expected, anything else is skipped up to the next object.
+        // Arrays are framed too, rather than having the objects inside them run one by one
+        if (FrameDepth == 0)
+        {
+            if (Char == '{' || Char == '[')
+            {
+                FrameDepth = 1;
+                ReadOffset = ScanOffset - 1;
+                bSkippingStray = false;
+            }
+            else
+            {
+                if (Char != ' ' && Char != '\n' && Char != '\r' && Char != '\t' && !bSkippingStray)
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("MCPConnection: Client %d sent data outside any JSON object, skipping up to the next one"), Id);
+                    bSkippingStray = true;
+                }
+                ReadOffset = ScanOffset;
+            }
+            continue;
+        }
+
+        // Multi-byte UTF-8 sequences never contain ASCII bytes, so scanning bytes is safe
+        if (bInString)
+        {
+            if (bEscaped)
+            {
+                bEscaped = false;
+            }
+            else if (Char == '\\')
+            {
+                bEscaped = true;
+            }
+            else if (Char == '"')
+            {
+                bInString = false;
+            }
+            continue;
+        }
+
+        if (Char == '"')
+        {
+            bInString = true;
+        }
+        else if (Char == '{' || Char == '[')
+        {
+            FrameDepth++;
+        }
+        else if ((Char == '}' || Char == ']') && --FrameDepth == 0)
+        {
+            const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data + ReadOffset), ScanOffset - ReadOffset);
+            OutMessage = FString(Converted.Length(), Converted.Get());
+            ReadOffset = ScanOffset;
+            return true;
+        }
+    }
+    return false;
+}
+
+void FMCPConnection::EndRequest()
+{
+    RequestsInFlight.fetch_sub(1, std::memory_order_relaxed);
+
+    // The worker may be holding back this client's requests, or waiting on another socket while a response is left to send
+    if (Poller.IsValid())
+    {
+        Poller->Wake();
+    }
+}
+
+void FMCPConnection::CompactReceiveBuffer()
+{
+    // Moving the unread tail is cheaper than the reads that filled the consumed part, and often there is no tail at all
+    if (ReadOffset > 0 && ReadOffset >= ReceiveBuffer.Num() - ReadOffset)
+    {
+        const int32 Remaining = ReceiveBuffer.Num() - ReadOffset;
+        FMemory::Memmove(ReceiveBuffer.GetData(), ReceiveBuffer.GetData() + ReadOffset, Remaining);
+        ReceiveBuffer.SetNum(Remaining, EAllowShrinking::No);
+        ScanOffset -= ReadOffset;
+        ReadOffset = 0;
+    }
+}
+
+void FMCPConnection::QueueMessage(const FString& Message)
+{
+    // Converted once into the queue; the byte count is the UTF-8 length, not the TCHAR count
+    const FTCHARToUTF8 Converted(*Message, Message.Len());
+
+    FScopeLock Lock(&SendLock);
+    SendBuffer.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+
+    // Newline terminated, so line based clients can frame responses too
+    SendBuffer.Add('\n');
+
+    // Errors surface on the worker's next flush
+    int32 BytesSent = 0;
+    FlushSend(BytesSent);
+}
+
+bool FMCPConnection::FlushSend(int32& OutBytesSent)
+{
+    FScopeLock Lock(&SendLock);
+
+    OutBytesSent = 0;
+    while (SendOffset < SendBuffer.Num())
+    {
+        int32 BytesSent = 0;
+        if (!Socket->Send(SendBuffer.GetData() + SendOffset, SendBuffer.Num() - SendOffset, BytesSent))
+        {
+            const ESocketErrors LastError = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode();
+
+            // Socket buffer full, the rest goes once it is writable again
+            if (LastError == SE_EWOULDBLOCK || LastError == SE_EINTR)
+            {
+                break;
+            }
+
+            UE_LOG(LogTemp, Warning, TEXT("MCPConnection: Failed to send response to client %d. Last error code: %d"), Id, (int32)LastError);
+            return false;
+        }
+
+        if (BytesSent <= 0)
+        {
+            break;
+        }
+        SendOffset += BytesSent;
+        OutBytesSent += BytesSent;
+    }
+
+    if (SendOffset == SendBuffer.Num())
+    {
+        if (SendBuffer.Max() > RetainedSendBufferSize)
+        {
+            SendBuffer.Empty();
+        }
+        else
+        {
+            SendBuffer.Reset();
+        }
+        SendOffset = 0;
+    }
+    else if (SendOffset >= SendBuffer.Num() - SendOffset)
+    {
+        const int32 Remaining = SendBuffer.Num() - SendOffset;
+        FMemory::Memmove(SendBuffer.GetData(), SendBuffer.GetData() + SendOffset, Remaining);
+        SendBuffer.SetNum(Remaining, EAllowShrinking::No);
+        SendOffset = 0;
+    }
+    return true;
+}
+
+int32 FMCPConnection::GetPendingSendBytes() const
+{
+    FScopeLock Lock(&SendLock);
+    return SendBuffer.Num() - SendOffset;
+}
@@ -0,0 +1,232 @@
+#include "MCPIOWorker.h"
+#include "MCPConnection.h"
+#include "MCPSocketPoller.h"
+#include "UnrealMCPBridge.h"
+#include "HAL/RunnableThread.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+#include "Tasks/Task.h"
+
+FMCPIOWorker::FMCPIOWorker(UUnrealMCPBridge* InBridge, int32 InIndex)
+    : Bridge(InBridge)
+    , Index(InIndex)
+    , Thread(nullptr)
+    , bRunning(true)
+    , NumConnections(0)
+    , Poller(MakeShared<FMCPSocketPoller>())
+{
+    Thread = FRunnableThread::Create(this, *FString::Printf(TEXT("UnrealMCPIOWorker%d"), Index), 0, TPri_Normal);
+}
+
+FMCPIOWorker::~FMCPIOWorker()
+{
+    if (Thread)
+    {
+        Thread->Kill(true);
+        delete Thread;
+        Thread = nullptr;
+    }
+}
+
+void FMCPIOWorker::AddConnection(TSharedPtr<FMCPConnection> Connection)
+{
+    NumConnections.fetch_add(1, std::memory_order_relaxed);
+    Connection->SetPoller(Poller);
+    PendingConnections.Enqueue(MoveTemp(Connection));
+    Poller->Wake();
+}
+
+uint32 FMCPIOWorker::Run()
+{
+    UE_LOG(LogTemp, Display, TEXT("MCPIOWorker %d: Starting"), Index);
+
+    while (bRunning)
+    {
+        TSharedPtr<FMCPConnection> NewConnection;
+        while (PendingConnections.Dequeue(NewConnection))
+        {
+            Connections.Add(MoveTemp(NewConnection));
+        }
+
+        // Served until a pass finds nothing to do, then blocked until something changes.
+        // Without clients that is only the wake socket, so the listener handing one over
+        if (!ServeConnections())
+        {
+            WaitForActivity();
+        }
+    }
+
+    // Closes the sockets of every client still connected
+    Connections.Reset();
+    PendingConnections.Empty();
+
+    UE_LOG(LogTemp, Display, TEXT("MCPIOWorker %d: Stopping"), Index);
+    return 0;
+}
+
+void FMCPIOWorker::Stop()
+{
+    bRunning = false;
+    Poller->Wake();
+}
+
+bool FMCPIOWorker::ServeConnections()
+{
+    bool bActivity = false;
+    for (int32 ConnectionIndex = Connections.Num() - 1; ConnectionIndex >= 0; ConnectionIndex--)
+    {
+        const TSharedPtr<FMCPConnection>& ConnectionPtr = Connections[ConnectionIndex];
+        FMCPConnection& Connection = *ConnectionPtr;
+
+        int32 BytesSent = 0;
+        bool bConnected = Connection.FlushSend(BytesSent);
+        bActivity |= BytesSent > 0;
+
+        // Backpressure: a client that does not read its responses, or has too many requests running,
+        // gets no new requests served and nothing more read, so TCP flow control stalls its sends too.
+        // Messages already buffered go first, so reading only resumes once none is left
+        if (bConnected)
+        {
+            bActivity |= DispatchMessages(ConnectionPtr);
+            if (!Connection.IsSendBackedUp() && Connection.CanBeginRequest())
+            {
+                int32 BytesRead = 0;
+                bConnected = Connection.Receive(BytesRead);
+                bActivity |= BytesRead > 0;
+                bActivity |= DispatchMessages(ConnectionPtr);
+            }
+        }
+
+        if (!bConnected)
+        {
+            Connections.RemoveAtSwap(ConnectionIndex);
+            NumConnections.fetch_sub(1, std::memory_order_relaxed);
+            bActivity = true;
+        }
+    }
+    return bActivity;
+}
+
+bool FMCPIOWorker::DispatchMessages(const TSharedPtr<FMCPConnection>& Connection)
+{
+    bool bDispatched = false;
+    FString Message;
+    while (!Connection->IsSendBackedUp() && Connection->CanBeginRequest() && Connection->PopMessage(Message))
+    {
+        ProcessMessage(Connection, Message);
+        bDispatched = true;
+    }
+    return bDispatched;
+}
+
+void FMCPIOWorker::WaitForActivity()
+{
+    // A wake sent before this point is still pending on the poller's socket, so checking first cannot miss one
+    if (!bRunning || !PendingConnections.IsEmpty())
+    {
+        return;
+    }
+
+    for (const TSharedPtr<FMCPConnection>& Connection : Connections)
+    {
+        // Queued responses resume on writability. A backed up or throttled client is not read from,
+        // so waiting for it to be readable would return at once; a finished request wakes the worker instead
+        const bool bReading = !Connection->IsSendBackedUp() && Connection->CanBeginRequest();
+        const bool bWriting = Connection->GetPendingSendBytes() > 0;
+        if (bReading || bWriting)
+        {
+            Poller->Add(Connection->GetSocket(), bReading, bWriting);
+        }
+    }
+
+    Poller->Wait();
+}
+
+void FMCPIOWorker::ProcessMessage(const TSharedPtr<FMCPConnection>& Connection, const FString& Message)
+{
+    UE_LOG(LogTemp, Verbose, TEXT("MCPIOWorker %d: Received from client %d: %s"), Index, Connection->GetId(), *Message);
+
+    // Framed as a whole so none of its elements runs, several commands go through "batch" instead
+    if (Message.StartsWith(TEXT("[")))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPIOWorker %d: Client %d sent a JSON array instead of an object"), Index, Connection->GetId());
+        QueueError(*Connection, nullptr, TEXT("Expected a JSON object, send several commands with the 'batch' command"));
+        return;
+    }
+
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPIOWorker %d: Failed to parse JSON from: %s"), Index, *Message);
+        QueueError(*Connection, nullptr, TEXT("Invalid JSON"));
+        return;
+    }
+
+    // Any JSON value the client picked, echoed back untouched with the response
+    const TSharedPtr<FJsonValue> RequestId = JsonObject->TryGetField(TEXT("id"));
+
+    // Clients send the command name as "type", the older MCP framing used "command"
+    FString CommandType;
+    if (!JsonObject->TryGetStringField(TEXT("type"), CommandType) && !JsonObject->TryGetStringField(TEXT("command"), CommandType))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPIOWorker %d: Missing 'type' field in command"), Index);
+        QueueError(*Connection, RequestId, TEXT("Missing 'type' field in command"));
+        return;
+    }
+
+    // Parameters are optional
+    TSharedPtr<FJsonObject> Params = MakeShareable(new FJsonObject());
+    const TSharedPtr<FJsonObject>* ParamsObject = nullptr;
+    if (JsonObject->TryGetObjectField(TEXT("params"), ParamsObject))
+    {
+        Params = *ParamsObject;
+    }
+
+    // The connection may be gone by the time the command completes
+    Connection->BeginRequest();
+    TWeakPtr<FMCPConnection> WeakConnection = Connection;
+    Bridge->ExecuteCommandAsync(CommandType, Params, [WeakConnection, RequestId](const TSharedRef<FJsonObject>& Response)
+    {
+        auto SendResponse = [WeakConnection, RequestId, Response]()
+        {
+            if (RequestId.IsValid())
+            {
+                Response->SetField(TEXT("id"), RequestId);
+            }
+            const FString ResponseString = UUnrealMCPBridge::SerializeResponse(Response);
+
+            if (TSharedPtr<FMCPConnection> Connection = WeakConnection.Pin())
+            {
+                UE_LOG(LogTemp, Verbose, TEXT("MCPIOWorker: Sending response to client %d: %s"), Connection->GetId(), *ResponseString);
+                Connection->QueueMessage(ResponseString);
+                Connection->EndRequest();
+            }
+        };
+
+        // Serializing a large result is left to a worker thread, the game thread only hands it over.
+        // Thread safe commands complete on a worker already and send straight away
+        if (IsInGameThread())
+        {
+            UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(SendResponse));
+        }
+        else
+        {
+            SendResponse();
+        }
+    });
+}
+
+void FMCPIOWorker::QueueError(FMCPConnection& Connection, const TSharedPtr<FJsonValue>& RequestId, const FString& Error)
+{
+    TSharedRef<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetStringField(TEXT("status"), TEXT("error"));
+    Response->SetStringField(TEXT("error"), Error);
+    if (RequestId.IsValid())
+    {
+        Response->SetField(TEXT("id"), RequestId);
+    }
+    Connection.QueueMessage(UUnrealMCPBridge::SerializeResponse(Response));
+}
@@ -0,0 +1,131 @@
+#include "MCPSocketPoller.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+
+// FSocketBSD is private to the Sockets module, see the include path added in UnrealMCP.Build.cs
+#include "BSDSockets/SocketsBSD.h"
+
+#if !PLATFORM_WINDOWS
+#include <poll.h>
+#endif
+
+namespace MCPSocketPoller
+{
+#if PLATFORM_WINDOWS
+    using FPollFd = WSAPOLLFD;
+
+    int32 Poll(FPollFd* Fds, int32 NumFds, int32 TimeoutMs)
+    {
+        return WSAPoll(Fds, ULONG(NumFds), TimeoutMs);
+    }
+#else
+    using FPollFd = pollfd;
+
+    int32 Poll(FPollFd* Fds, int32 NumFds, int32 TimeoutMs)
+    {
+        return poll(Fds, nfds_t(NumFds), TimeoutMs);
+    }
+#endif
+
+    // Only the wait when the wake socket could not be created, so a wake is at worst this late
+    constexpr double FallbackWaitSeconds = 0.01;
+
+    FPollFd MakePollFd(FSocket* Socket, bool bRead, bool bWrite)
+    {
+        // Every socket the platform subsystem creates on the editor's platforms is a BSD one
+        FPollFd Fd;
+        Fd.fd = static_cast<FSocketBSD*>(Socket)->GetNativeSocket();
+        Fd.events = (bRead ? POLLIN : 0) | (bWrite ? POLLOUT : 0);
+        Fd.revents = 0;
+        return Fd;
+    }
+}
+
+FMCPSocketPoller::FMCPSocketPoller()
+    : WakeSocket(nullptr)
+    , bWakePending(false)
+{
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+
+    // Port 0 lets the OS pick a free one, read back once bound so Wake knows where to send
+    WakeAddress = SocketSubsystem->CreateInternetAddr();
+    WakeAddress->SetLoopbackAddress();
+    WakeAddress->SetPort(0);
+
+    WakeSocket = SocketSubsystem->CreateSocket(NAME_DGram, TEXT("UnrealMCPWake"), false);
+    if (!WakeSocket || !WakeSocket->SetNonBlocking(true) || !WakeSocket->Bind(*WakeAddress) || !WakeSocket->GetAddress(*WakeAddress))
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCPSocketPoller: Could not create the wake socket, waits are capped at %.0f ms instead"), MCPSocketPoller::FallbackWaitSeconds * 1000.0);
+        if (WakeSocket)
+        {
+            SocketSubsystem->DestroySocket(WakeSocket);
+            WakeSocket = nullptr;
+        }
+    }
+}
+
+FMCPSocketPoller::~FMCPSocketPoller()
+{
+    if (WakeSocket)
+    {
+        WakeSocket->Close();
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(WakeSocket);
+    }
+}
+
+void FMCPSocketPoller::Wake()
+{
+    if (!WakeSocket || bWakePending.exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    // Non-blocking, a full buffer only means a wake is already waiting to be read
+    const uint8 Byte = 0;
+    int32 BytesSent = 0;
+    WakeSocket->SendTo(&Byte, 1, BytesSent, *WakeAddress);
+}
+
+void FMCPSocketPoller::Add(FSocket* Socket, bool bRead, bool bWrite)
+{
+    Entries.Add({ Socket, bRead, bWrite });
+}
+
+void FMCPSocketPoller::Wait(double TimeoutSeconds)
+{
+    using namespace MCPSocketPoller;
+
+    TArray<FPollFd, TInlineAllocator<16>> Fds;
+    if (WakeSocket)
+    {
+        Fds.Add(MakePollFd(WakeSocket, true, false));
+    }
+    else
+    {
+        TimeoutSeconds = TimeoutSeconds < 0.0 ? FallbackWaitSeconds : FMath::Min(TimeoutSeconds, FallbackWaitSeconds);
+    }
+
+    for (const FEntry& Entry : Entries)
+    {
+        Fds.Add(MakePollFd(Entry.Socket, Entry.bRead, Entry.bWrite));
+    }
+    Entries.Reset();
+
+    // An interrupted or failed poll just returns, the caller looks at its sockets and waits again
+    const int32 TimeoutMs = TimeoutSeconds < 0.0 ? -1 : FMath::CeilToInt(TimeoutSeconds * 1000.0);
+    Poll(Fds.GetData(), Fds.Num(), TimeoutMs);
+
+    if (WakeSocket && Fds[0].revents != 0)
+    {
+        uint8 Buffer[64];
+        int32 BytesRead = 0;
+        while (WakeSocket->Recv(Buffer, sizeof(Buffer), BytesRead) && BytesRead > 0)
+        {
+        }
+    }
+
+    // Cleared after draining, so a wake arriving in between is either drained and served by the caller
+    // right after this returns, or sends a fresh datagram for the next wait
+    bWakePending.store(false, std::memory_order_release);
+}
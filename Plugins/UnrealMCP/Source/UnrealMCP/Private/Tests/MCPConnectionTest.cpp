@@ -0,0 +1,160 @@
+#include "Misc/AutomationTest.h"
+#include "MCPConnection.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MCPConnectionTest
+{
+    /** A connection on the accepted end of a loopback pair, fed by writing to the client end */
+    struct FLoopbackConnection
+    {
+        FSocket* Client = nullptr;
+        TUniquePtr<FMCPConnection> Connection;
+
+        ~FLoopbackConnection()
+        {
+            // The connection destroys the accepted socket itself
+            Connection.Reset();
+            if (Client)
+            {
+                Client->Close();
+                ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Client);
+            }
+        }
+
+        bool Open()
+        {
+            ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+            FSocket* Listener = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("UnrealMCPTestListener"), false);
+            ON_SCOPE_EXIT
+            {
+                Listener->Close();
+                SocketSubsystem->DestroySocket(Listener);
+            };
+
+            // Port 0 lets the OS pick a free one, read back once bound
+            TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr();
+            Address->SetLoopbackAddress();
+            Address->SetPort(0);
+            if (!Listener->Bind(*Address) || !Listener->Listen(1))
+            {
+                return false;
+            }
+            Listener->GetAddress(*Address);
+
+            Client = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("UnrealMCPTestClient"), false);
+            bool bPending = false;
+            if (!Client->Connect(*Address) || !Listener->WaitForPendingConnection(bPending, FTimespan::FromSeconds(5.0)) || !bPending)
+            {
+                return false;
+            }
+
+            FSocket* Accepted = Listener->Accept(TEXT("UnrealMCPTestServer"));
+            if (!Accepted)
+            {
+                return false;
+            }
+            Connection = MakeUnique<FMCPConnection>(Accepted, 1);
+            return true;
+        }
+
+        /** Sends the bytes and receives until all of them are in the connection's buffer */
+        bool Feed(const uint8* Data, int32 Num)
+        {
+            for (int32 Sent = 0; Sent < Num;)
+            {
+                int32 BytesSent = 0;
+                if (!Client->Send(Data + Sent, Num - Sent, BytesSent))
+                {
+                    return false;
+                }
+                Sent += BytesSent;
+            }
+
+            int32 Received = 0;
+            const double Deadline = FPlatformTime::Seconds() + 5.0;
+            while (Received < Num && FPlatformTime::Seconds() < Deadline)
+            {
+                Connection->GetSocket()->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(100));
+
+                int32 BytesRead = 0;
+                if (!Connection->Receive(BytesRead))
+                {
+                    return false;
+                }
+                Received += BytesRead;
+            }
+            return Received == Num;
+        }
+
+        bool Feed(const FString& Text)
+        {
+            const FTCHARToUTF8 Converted(*Text, Text.Len());
+            return Feed(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+        }
+
+        /** The next complete message, empty if there is none yet */
+        FString Pop()
+        {
+            FString Message;
+            return Connection->PopMessage(Message) ? Message : FString();
+        }
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPConnectionFramingTest, "UnrealMCP.Connection.Framing",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMCPConnectionFramingTest::RunTest(const FString& Parameters)
+{
+    MCPConnectionTest::FLoopbackConnection Loopback;
+    if (!TestTrue(TEXT("Opens a loopback connection"), Loopback.Open()))
+    {
+        return false;
+    }
+
+    // A frame split across reads only pops once its closing brace arrives
+    TestTrue(TEXT("Feeds the first half"), Loopback.Feed(TEXT("{\"type\": \"pi")));
+    TestEqual(TEXT("Half a frame is not a message"), Loopback.Pop(), FString());
+    TestTrue(TEXT("Feeds the second half"), Loopback.Feed(TEXT("ng\"}\n")));
+    TestEqual(TEXT("The joined frame"), Loopback.Pop(), FString(TEXT("{\"type\": \"ping\"}")));
+
+    // Braces and brackets inside strings do not count
+    const FString BracesInString = TEXT("{\"a\": \"}{ ][\", \"b\": [\"}\"]}");
+    TestTrue(TEXT("Feeds braces in a string"), Loopback.Feed(BracesInString));
+    TestEqual(TEXT("Braces in a string"), Loopback.Pop(), BracesInString);
+
+    // An escaped quote does not end the string, an escaped backslash does not escape the quote after it
+    const FString Escapes = TEXT("{\"a\": \"\\\"}\\\\\", \"b\": \"\\\\\"}");
+    TestTrue(TEXT("Feeds escapes"), Loopback.Feed(Escapes));
+    TestEqual(TEXT("Escaped quotes and backslashes"), Loopback.Pop(), Escapes);
+
+    // Several frames in one read, with and without separators
+    TestTrue(TEXT("Feeds back to back frames"), Loopback.Feed(TEXT("{\"n\": 1}{\"n\": 2}\r\n{\"n\": 3}")));
+    TestEqual(TEXT("First of three"), Loopback.Pop(), FString(TEXT("{\"n\": 1}")));
+    TestEqual(TEXT("Second of three"), Loopback.Pop(), FString(TEXT("{\"n\": 2}")));
+    TestEqual(TEXT("Third of three"), Loopback.Pop(), FString(TEXT("{\"n\": 3}")));
+    TestEqual(TEXT("Nothing left"), Loopback.Pop(), FString());
+
+    // Multi-byte UTF-8, split in the middle of a four byte sequence
+    const FString Unicode = TEXT("{\"name\": \"Gr\u00F6\u00DFe \u2713 \U0001F3AE\"}");
+    const FTCHARToUTF8 UnicodeUTF8(*Unicode, Unicode.Len());
+    const uint8* UnicodeBytes = reinterpret_cast<const uint8*>(UnicodeUTF8.Get());
+    const int32 SplitAt = UnicodeUTF8.Length() - 4;
+    TestTrue(TEXT("Feeds UTF-8 up to the middle of a character"), Loopback.Feed(UnicodeBytes, SplitAt));
+    TestEqual(TEXT("Half a character is not a message"), Loopback.Pop(), FString());
+    TestTrue(TEXT("Feeds the rest of the UTF-8"), Loopback.Feed(UnicodeBytes + SplitAt, UnicodeUTF8.Length() - SplitAt));
+    TestEqual(TEXT("Multi-byte UTF-8"), Loopback.Pop(), Unicode);
+
+    // Stray bytes are skipped, and a top-level array comes out whole for the worker to reject
+    TestTrue(TEXT("Feeds stray bytes and an array"), Loopback.Feed(TEXT("garbage} [1, {\"x\": 2}] {\"y\": 3}")));
+    TestEqual(TEXT("The array as one frame"), Loopback.Pop(), FString(TEXT("[1, {\"x\": 2}]")));
+    TestEqual(TEXT("The object after it"), Loopback.Pop(), FString(TEXT("{\"y\": 3}")));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
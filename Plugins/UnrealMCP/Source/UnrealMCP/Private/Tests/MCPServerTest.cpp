@@ -0,0 +1,86 @@
+#include "Misc/AutomationTest.h"
+#include "UnrealMCPBridge.h"
+#include "Editor.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPServerRoundTripTest, "UnrealMCP.Server.RoundTrip",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMCPServerRoundTripTest::RunTest(const FString& Parameters)
+{
+    UUnrealMCPBridge* Bridge = GEditor ? GEditor->GetEditorSubsystem<UUnrealMCPBridge>() : nullptr;
+    if (!Bridge || !Bridge->IsRunning())
+    {
+        AddError(TEXT("The MCP bridge is not running"));
+        return false;
+    }
+
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    FSocket* Client = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("UnrealMCPTestClient"), false);
+    ON_SCOPE_EXIT
+    {
+        Client->Close();
+        SocketSubsystem->DestroySocket(Client);
+    };
+
+    const FIPv4Endpoint Endpoint(Bridge->GetServerAddress(), Bridge->GetPort());
+    if (!TestTrue(TEXT("Connects over loopback"), Client->Connect(*Endpoint.ToInternetAddr())))
+    {
+        return false;
+    }
+
+    // ping runs off the game thread, so the reply arrives while this test holds the game thread
+    const FTCHARToUTF8 Request(TEXT("{\"type\": \"ping\", \"id\": 7}"));
+    int32 BytesSent = 0;
+    TestTrue(TEXT("Sends the request"), Client->Send(reinterpret_cast<const uint8*>(Request.Get()), Request.Length(), BytesSent));
+
+    // Read up to the newline ending the response
+    TArray<uint8> Reply;
+    const double Deadline = FPlatformTime::Seconds() + 5.0;
+    while (!Reply.Contains('\n') && FPlatformTime::Seconds() < Deadline)
+    {
+        if (!Client->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(100)))
+        {
+            continue;
+        }
+
+        uint8 Buffer[1024];
+        int32 BytesRead = 0;
+        if (!Client->Recv(Buffer, sizeof(Buffer), BytesRead))
+        {
+            break;
+        }
+        Reply.Append(Buffer, BytesRead);
+    }
+
+    if (!TestTrue(TEXT("A full response line arrives"), Reply.Contains('\n')))
+    {
+        return false;
+    }
+
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Reply.GetData()), Reply.Num());
+    const FString ReplyString(Converted.Length(), Converted.Get());
+
+    TSharedPtr<FJsonObject> Response;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ReplyString);
+    if (!TestTrue(TEXT("The response is JSON"), FJsonSerializer::Deserialize(Reader, Response) && Response.IsValid()))
+    {
+        return false;
+    }
+
+    TestEqual(TEXT("Status"), Response->GetStringField(TEXT("status")), FString(TEXT("success")));
+    TestEqual(TEXT("The request id is echoed"), Response->GetIntegerField(TEXT("id")), 7);
+
+    const TSharedPtr<FJsonObject>* Result = nullptr;
+    if (TestTrue(TEXT("The response has a result"), Response->TryGetObjectField(TEXT("result"), Result)))
+    {
+        TestEqual(TEXT("Pong"), (*Result)->GetStringField(TEXT("message")), FString(TEXT("pong")));
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,69 @@
+#include "Misc/AutomationTest.h"
+#include "MCPSocketPoller.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPSocketPollerTest, "UnrealMCP.Connection.Poller",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FMCPSocketPollerTest::RunTest(const FString& Parameters)
+{
+    FMCPSocketPoller Poller;
+
+    // Nothing added and nothing woken, so only the timeout ends it
+    double Start = FPlatformTime::Seconds();
+    Poller.Wait(0.05);
+    TestTrue(TEXT("A quiet wait lasts its timeout"), FPlatformTime::Seconds() - Start >= 0.04);
+
+    // A wake before the wait is kept for it
+    Poller.Wake();
+    Start = FPlatformTime::Seconds();
+    Poller.Wait(5.0);
+    TestTrue(TEXT("An earlier wake ends the next wait at once"), FPlatformTime::Seconds() - Start < 1.0);
+
+    // From another thread while blocked without a timeout
+    TFuture<void> Waker = Async(EAsyncExecution::Thread, [&Poller]()
+    {
+        FPlatformProcess::Sleep(0.05f);
+        Poller.Wake();
+    });
+    Start = FPlatformTime::Seconds();
+    Poller.Wait();
+    Waker.Wait();
+    TestTrue(TEXT("A wake from another thread ends a wait without timeout"), FPlatformTime::Seconds() - Start < 5.0);
+
+    // A datagram on an added socket ends the wait too
+    ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    FSocket* Socket = SocketSubsystem->CreateSocket(NAME_DGram, TEXT("UnrealMCPTestPolled"), false);
+    ON_SCOPE_EXIT
+    {
+        Socket->Close();
+        SocketSubsystem->DestroySocket(Socket);
+    };
+
+    TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr();
+    Address->SetLoopbackAddress();
+    Address->SetPort(0);
+    if (!TestTrue(TEXT("Binds the polled socket"), Socket->Bind(*Address) && Socket->GetAddress(*Address)))
+    {
+        return false;
+    }
+
+    const uint8 Byte = 1;
+    int32 BytesSent = 0;
+    Socket->SendTo(&Byte, 1, BytesSent, *Address);
+
+    Poller.Add(Socket, true, false);
+    Start = FPlatformTime::Seconds();
+    Poller.Wait(5.0);
+    TestTrue(TEXT("A readable socket ends the wait at once"), FPlatformTime::Seconds() - Start < 1.0);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -22,6 +22,9 @@
 #include "Engine/Selection.h"
 #include "Kismet/GameplayStatics.h"
 #include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "Tasks/Task.h"
 // Add Blueprint related includes
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
@@ -57,11 +60,23 @@
 #include "Commands/UnrealMCPProjectCommands.h"
 #include "Commands/UnrealMCPCommonUtils.h"
 #include "Commands/UnrealMCPUMGCommands.h"
+#include "Commands/UnrealMCPCommandRegistry.h"
 
 // Default settings
 #define MCP_SERVER_HOST "127.0.0.1"
 #define MCP_SERVER_PORT 55557
 
+namespace UnrealMCPBridge
+{
+    // Handled by the bridge itself, as its response wraps the responses of the commands in it
+    const FName BatchCommandName(TEXT("batch"));
+
+    TAutoConsoleVariable<float> CVarCommandBudgetMs(
+        TEXT("MCP.CommandBudgetMs"),
+        4.0f,
+        TEXT("Milliseconds per frame the MCP bridge spends running queued commands. At least one command runs every frame."));
+}
+
 UUnrealMCPBridge::UUnrealMCPBridge()
 {
     EditorCommands = MakeShared<FUnrealMCPEditorCommands>();
@@ -87,11 +102,22 @@ void UUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
     
     bIsRunning = false;
     ListenerSocket = nullptr;
-    ConnectionSocket = nullptr;
     ServerThread = nullptr;
     Port = MCP_SERVER_PORT;
     FIPv4Address::Parse(MCP_SERVER_HOST, ServerAddress);
 
+    // Built-in commands, other modules add theirs to the same registry
+    FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
+    Registry.RegisterCommand(TEXT("ping"), FMCPCommandHandler::CreateUObject(this, &UUnrealMCPBridge::HandlePing), EMCPCommandThread::AnyThread);
+    Registry.RegisterCommand(TEXT("get_server_stats"), FMCPCommandHandler::CreateUObject(this, &UUnrealMCPBridge::HandleGetServerStats), EMCPCommandThread::AnyThread);
+    EditorCommands->RegisterCommands(Registry);
+    BlueprintCommands->RegisterCommands(Registry);
+    BlueprintNodeCommands->RegisterCommands(Registry);
+    ProjectCommands->RegisterCommands(Registry);
+    UMGCommands->RegisterCommands(Registry);
+
+    DrainTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UUnrealMCPBridge::DrainCommandQueue));
+
     // Start the server automatically
     StartServer();
 }
@@ -101,6 +127,33 @@ void UUnrealMCPBridge::Deinitialize()
 {
     UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Shutting down"));
     StopServer();
+
+    FTSTicker::GetCoreTicker().RemoveTicker(DrainTickerHandle);
+
+    // No new requests arrive once the server is stopped, so this only waits for those already running
+    while (NumRunningTasks.load(std::memory_order_acquire) > 0)
+    {
+        FPlatformProcess::Sleep(0.001f);
+    }
+
+    // Answer what is still queued, so nobody waiting on a response blocks forever
+    FQueuedCommand Command;
+    while (CommandQueue.Dequeue(Command))
+    {
+        TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), TEXT("Server is shutting down"));
+        Command.OnComplete(ResponseJson);
+    }
+    NumQueuedCommands = 0;
+
+    FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
+    Registry.UnregisterAll(this);
+    Registry.UnregisterAll(EditorCommands.Get());
+    Registry.UnregisterAll(BlueprintCommands.Get());
+    Registry.UnregisterAll(BlueprintNodeCommands.Get());
+    Registry.UnregisterAll(ProjectCommands.Get());
+    Registry.UnregisterAll(UMGCommands.Get());
 }
 
 // Start the MCP server
@@ -141,7 +194,7 @@ void UUnrealMCPBridge::StartServer()
     }
 
     // Start listening
-    if (!NewListenerSocket->Listen(5))
+    if (!NewListenerSocket->Listen(16))
     {
         UE_LOG(LogTemp, Error, TEXT("UnrealMCPBridge: Failed to start listening"));
         return;
@@ -184,13 +237,7 @@ void UUnrealMCPBridge::StopServer()
         ServerThread = nullptr;
     }
 
-    // Close sockets
-    if (ConnectionSocket.IsValid())
-    {
-        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ConnectionSocket.Get());
-        ConnectionSocket.Reset();
-    }
-
+    // Close the listener, client sockets were closed by the I/O workers as the thread stopped
     if (ListenerSocket.IsValid())
     {
         ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenerSocket.Get());
@@ -200,133 +247,254 @@ void UUnrealMCPBridge::StopServer()
     UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Server stopped"));
 }
 
-// Execute a command received from a client
-FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+void UUnrealMCPBridge::ExecuteCommandAsync(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FMCPCommandCompletion&& OnComplete)
 {
     UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Executing command: %s"), *CommandType);
+
+    // Thread safe commands, such as health checks and lookups, never wait for a frame
+    const TSharedPtr<const FMCPRegisteredCommand> Command = FUnrealMCPCommandRegistry::Get().FindCommand(FName(*CommandType, FNAME_Find));
+    if (Command.IsValid() && Command->Thread == EMCPCommandThread::AnyThread)
+    {
+        const double QueuedTime = FPlatformTime::Seconds();
+        NumRunningTasks.fetch_add(1, std::memory_order_relaxed);
+        UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, Command, Params, QueuedTime, OnComplete = MoveTemp(OnComplete)]() mutable
+        {
+            const double ExecutionStart = FPlatformTime::Seconds();
+            TSharedRef<FJsonObject> ResponseJson = RunHandler(Command->Handler, Params);
+            RecordTiming(ResponseJson, ExecutionStart - QueuedTime, FPlatformTime::Seconds() - ExecutionStart);
+            OnComplete(ResponseJson);
+
+            // Released here rather than whenever the task frees its body, as unregistering waits on
+            // the command and Deinitialize on the count before their handler objects are destroyed
+            Command.Reset();
+            NumRunningTasks.fetch_sub(1, std::memory_order_release);
+        });
+        return;
+    }
+
+    // One queue drained per frame instead of a named thread task per command, see DrainCommandQueue
+    CommandQueue.Enqueue({ CommandType, Params, MoveTemp(OnComplete), FPlatformTime::Seconds() });
+    NumQueuedCommands.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool UUnrealMCPBridge::DrainCommandQueue(float DeltaTime)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    const double EndTime = StartTime + UnrealMCPBridge::CVarCommandBudgetMs.GetValueOnGameThread() / 1000.0;
+
+    // Always at least one command, so a budget smaller than the slowest command still makes progress
+    int32 NumExecuted = 0;
+    FQueuedCommand Command;
+    while ((NumExecuted == 0 || FPlatformTime::Seconds() < EndTime) && CommandQueue.Dequeue(Command))
+    {
+        NumQueuedCommands.fetch_sub(1, std::memory_order_relaxed);
+
+        const double ExecutionStart = FPlatformTime::Seconds();
+        TSharedRef<FJsonObject> ResponseJson = HandleCommand(Command.CommandType, Command.Params);
+        const double ExecutionEnd = FPlatformTime::Seconds();
+
+        RecordTiming(ResponseJson, ExecutionStart - Command.QueuedTime, ExecutionEnd - ExecutionStart);
+        NumExecuted++;
+
+        Command.OnComplete(ResponseJson);
+    }
+
+    const int32 NumRemaining = NumQueuedCommands.load(std::memory_order_relaxed);
+    if (NumRemaining > 0)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("UnrealMCPBridge: Ran %d commands in %.2f ms, %d carried over to the next frame"),
+            NumExecuted, (FPlatformTime::Seconds() - StartTime) * 1000.0, NumRemaining);
+    }
+
+    // Keep ticking
+    return true;
+}
+
+void UUnrealMCPBridge::RecordTiming(const TSharedRef<FJsonObject>& ResponseJson, double QueueWait, double Execution)
+{
+    // Time spent queued shows load on the editor, time spent executing shows the cost of the command itself
+    TSharedPtr<FJsonObject> TimingJson = MakeShared<FJsonObject>();
+    TimingJson->SetNumberField(TEXT("queue_ms"), QueueWait * 1000.0);
+    TimingJson->SetNumberField(TEXT("execution_ms"), Execution * 1000.0);
+    ResponseJson->SetObjectField(TEXT("timing"), TimingJson);
+
+    FScopeLock Lock(&StatsLock);
+    NumExecutedCommands++;
+    TotalQueueWaitSeconds += QueueWait;
+    MaxQueueWaitSeconds = FMath::Max(MaxQueueWaitSeconds, QueueWait);
+    TotalExecutionSeconds += Execution;
+}
+
+FString UUnrealMCPBridge::SerializeResponse(const TSharedRef<FJsonObject>& ResponseJson)
+{
+    // Condensed, so a response never spans more than one line on the wire
+    FString ResultString;
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ResultString);
+    FJsonSerializer::Serialize(ResponseJson, Writer);
+    return ResultString;
+}
+
+TSharedRef<FJsonObject> UUnrealMCPBridge::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    check(IsInGameThread());
+
+    // FNAME_Find, so unknown commands from clients never grow the name table
+    const FName CommandName(*CommandType, FNAME_Find);
+
+    // Many commands in one game thread hop, see HandleBatch
+    if (CommandName == UnrealMCPBridge::BatchCommandName)
+    {
+        return HandleBatch(Params);
+    }
+
+    // Thread safe commands in a batch run here too, they are fine on the game thread
+    const TSharedPtr<const FMCPRegisteredCommand> Command = FUnrealMCPCommandRegistry::Get().FindCommand(CommandName);
+    if (!Command.IsValid())
+    {
+        TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
+        return ResponseJson;
+    }
+    return RunHandler(Command->Handler, Params);
+}
+
+TSharedRef<FJsonObject> UUnrealMCPBridge::RunHandler(const FMCPCommandHandler& Handler, const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
     
-    // Create a promise to wait for the result
-    TPromise<FString> Promise;
-    TFuture<FString> Future = Promise.GetFuture();
-    
-    // Queue execution on Game Thread
-    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Promise = MoveTemp(Promise)]() mutable
+    try
     {
-        TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+        TSharedPtr<FJsonObject> ResultJson = Handler.Execute(Params);
+        
+        // Check if the result contains an error
+        bool bSuccess = true;
+        FString ErrorMessage;
         
-        try
+        if (ResultJson->HasField(TEXT("success")))
         {
-            TSharedPtr<FJsonObject> ResultJson;
-            
-            if (CommandType == TEXT("ping"))
+            bSuccess = ResultJson->GetBoolField(TEXT("success"));
+            if (!bSuccess && ResultJson->HasField(TEXT("error")))
             {
-                ResultJson = MakeShareable(new FJsonObject);
-                ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+                ErrorMessage = ResultJson->GetStringField(TEXT("error"));
             }
-            // Editor Commands (including actor manipulation)
-            else if (CommandType == TEXT("get_actors_in_level") || 
-                     CommandType == TEXT("find_actors_by_name") ||
-                     CommandType == TEXT("spawn_actor") ||
-                     CommandType == TEXT("create_actor") ||
-                     CommandType == TEXT("delete_actor") || 
-                     CommandType == TEXT("set_actor_transform") ||
-                     CommandType == TEXT("get_actor_properties") ||
-                     CommandType == TEXT("set_actor_property") ||
-                     CommandType == TEXT("spawn_blueprint_actor") ||
-                     CommandType == TEXT("focus_viewport") || 
-                     CommandType == TEXT("take_screenshot"))
-            {
-                ResultJson = EditorCommands->HandleCommand(CommandType, Params);
-            }
-            // Blueprint Commands
-            else if (CommandType == TEXT("create_blueprint") || 
-                     CommandType == TEXT("add_component_to_blueprint") || 
-                     CommandType == TEXT("set_component_property") || 
-                     CommandType == TEXT("set_physics_properties") || 
-                     CommandType == TEXT("compile_blueprint") || 
-                     CommandType == TEXT("set_blueprint_property") || 
-                     CommandType == TEXT("set_static_mesh_properties") ||
-                     CommandType == TEXT("set_pawn_properties"))
-            {
-                ResultJson = BlueprintCommands->HandleCommand(CommandType, Params);
-            }
-            // Blueprint Node Commands
-            else if (CommandType == TEXT("connect_blueprint_nodes") || 
-                     CommandType == TEXT("add_blueprint_get_self_component_reference") ||
-                     CommandType == TEXT("add_blueprint_self_reference") ||
-                     CommandType == TEXT("find_blueprint_nodes") ||
-                     CommandType == TEXT("add_blueprint_event_node") ||
-                     CommandType == TEXT("add_blueprint_input_action_node") ||
-                     CommandType == TEXT("add_blueprint_function_node") ||
-                     CommandType == TEXT("add_blueprint_get_component_node") ||
-                     CommandType == TEXT("add_blueprint_variable"))
-            {
-                ResultJson = BlueprintNodeCommands->HandleCommand(CommandType, Params);
-            }
-            // Project Commands
-            else if (CommandType == TEXT("create_input_mapping"))
-            {
-                ResultJson = ProjectCommands->HandleCommand(CommandType, Params);
-            }
-            // UMG Commands
-            else if (CommandType == TEXT("create_umg_widget_blueprint") ||
-                     CommandType == TEXT("add_text_block_to_widget") ||
-                     CommandType == TEXT("add_button_to_widget") ||
-                     CommandType == TEXT("bind_widget_event") ||
-                     CommandType == TEXT("set_text_block_binding") ||
-                     CommandType == TEXT("add_widget_to_viewport"))
-            {
-                ResultJson = UMGCommands->HandleCommand(CommandType, Params);
-            }
-            else
-            {
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
-                
-                FString ResultString;
-                TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-                FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-                Promise.SetValue(ResultString);
-                return;
-            }
-            
-            // Check if the result contains an error
-            bool bSuccess = true;
-            FString ErrorMessage;
-            
-            if (ResultJson->HasField(TEXT("success")))
-            {
-                bSuccess = ResultJson->GetBoolField(TEXT("success"));
-                if (!bSuccess && ResultJson->HasField(TEXT("error")))
-                {
-                    ErrorMessage = ResultJson->GetStringField(TEXT("error"));
-                }
-            }
-            
-            if (bSuccess)
-            {
-                // Set success status and include the result
-                ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-                ResponseJson->SetObjectField(TEXT("result"), ResultJson);
-            }
-            else
+        }
+        
+        if (bSuccess)
+        {
+            // Set success status and include the result
+            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+            ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+        }
+        else
+        {
+            // Set error status and include the error message
+            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+            ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
+    }
+
+    return ResponseJson;
+}
+
+TSharedPtr<FJsonObject> UUnrealMCPBridge::HandlePing(const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+    ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+    return ResultJson;
+}
+
+TSharedPtr<FJsonObject> UUnrealMCPBridge::HandleGetServerStats(const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+    ResultJson->SetNumberField(TEXT("queued_commands"), NumQueuedCommands.load(std::memory_order_relaxed));
+    ResultJson->SetNumberField(TEXT("registered_commands"), FUnrealMCPCommandRegistry::Get().GetNumCommands());
+
+    FScopeLock Lock(&StatsLock);
+    const double NumExecuted = FMath::Max<double>(NumExecutedCommands, 1.0);
+    ResultJson->SetNumberField(TEXT("executed_commands"), double(NumExecutedCommands));
+    ResultJson->SetNumberField(TEXT("average_queue_ms"), TotalQueueWaitSeconds * 1000.0 / NumExecuted);
+    ResultJson->SetNumberField(TEXT("max_queue_ms"), MaxQueueWaitSeconds * 1000.0);
+    ResultJson->SetNumberField(TEXT("average_execution_ms"), TotalExecutionSeconds * 1000.0 / NumExecuted);
+    return ResultJson;
+}
+
+TSharedRef<FJsonObject> UUnrealMCPBridge::HandleBatch(const TSharedPtr<FJsonObject>& Params)
+{
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+
+    const TArray<TSharedPtr<FJsonValue>>* Commands = nullptr;
+    if (!Params.IsValid() || !Params->TryGetArrayField(TEXT("commands"), Commands))
+    {
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), TEXT("Missing 'commands' array parameter"));
+        return ResponseJson;
+    }
+
+    bool bStopOnError = false;
+    Params->TryGetBoolField(TEXT("stop_on_error"), bStopOnError);
+
+    UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Executing batch of %d commands"), Commands->Num());
+
+    // One response per command run, in order; with stop_on_error the failing one is the last
+    TArray<TSharedPtr<FJsonValue>> Results;
+    Results.Reserve(Commands->Num());
+    int32 NumFailed = 0;
+    for (const TSharedPtr<FJsonValue>& CommandValue : *Commands)
+    {
+        TSharedPtr<FJsonObject> SubResponse;
+        const TSharedPtr<FJsonObject>* CommandObject = nullptr;
+        FString SubCommandType;
+        if (!CommandValue.IsValid() || !CommandValue->TryGetObject(CommandObject)
+            || (!(*CommandObject)->TryGetStringField(TEXT("type"), SubCommandType) && !(*CommandObject)->TryGetStringField(TEXT("command"), SubCommandType)))
+        {
+            SubResponse = MakeShared<FJsonObject>();
+            SubResponse->SetStringField(TEXT("status"), TEXT("error"));
+            SubResponse->SetStringField(TEXT("error"), TEXT("Missing 'type' field in command"));
+        }
+        // Nesting would gain nothing and lets a client recurse without bound
+        else if (SubCommandType == TEXT("batch"))
+        {
+            SubResponse = MakeShared<FJsonObject>();
+            SubResponse->SetStringField(TEXT("status"), TEXT("error"));
+            SubResponse->SetStringField(TEXT("error"), TEXT("Batches cannot be nested"));
+        }
+        else
+        {
+            TSharedPtr<FJsonObject> SubParams = MakeShared<FJsonObject>();
+            const TSharedPtr<FJsonObject>* ParamsObject = nullptr;
+            if ((*CommandObject)->TryGetObjectField(TEXT("params"), ParamsObject))
             {
-                // Set error status and include the error message
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
+                SubParams = *ParamsObject;
             }
+            SubResponse = HandleCommand(SubCommandType, SubParams);
         }
-        catch (const std::exception& e)
+
+        const bool bFailed = SubResponse->GetStringField(TEXT("status")) != TEXT("success");
+        Results.Add(MakeShared<FJsonValueObject>(SubResponse));
+        if (bFailed)
         {
-            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-            ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
+            NumFailed++;
+            if (bStopOnError)
+            {
+                break;
+            }
         }
-        
-        FString ResultString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResultString);
-        FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
-        Promise.SetValue(ResultString);
-    });
-    
-    return Future.Get();
-}
\ No newline at end of file
+    }
+
+    // The batch itself succeeds even when commands in it fail, each result has its own status
+    TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+    ResultJson->SetArrayField(TEXT("results"), Results);
+    ResultJson->SetNumberField(TEXT("executed"), Results.Num());
+    ResultJson->SetNumberField(TEXT("failed"), NumFailed);
+    ResultJson->SetBoolField(TEXT("completed"), Results.Num() == Commands->Num());
+
+    ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+    ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+    return ResponseJson;
+}
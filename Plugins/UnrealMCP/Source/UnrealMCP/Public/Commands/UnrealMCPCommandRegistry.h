@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/** Runs one command and returns its result, or an error made with FUnrealMCPCommonUtils::CreateErrorResponse */
+DECLARE_DELEGATE_RetVal_OneParam(TSharedPtr<FJsonObject>, FMCPCommandHandler, const TSharedPtr<FJsonObject>& /*Params*/);
+
+/** Where a command may run, declared when it is registered */
+enum class EMCPCommandThread : uint8
+{
+    /** Touches UObjects or editor state, queued for the game thread */
+    GameThread,
+
+    /** Thread safe, run straight away on a task graph worker without waiting for a frame */
+    AnyThread
+};
+
+struct FMCPRegisteredCommand
+{
+    FMCPCommandHandler Handler;
+    EMCPCommandThread Thread;
+};
+
+/**
+ * Maps every MCP command name to its handler. Handler classes, including ones in
+ * modules that depend on this plugin, register their commands once at startup,
+ * so the bridge dispatches with a single hash lookup and never lists commands itself.
+ * Names are FNames and therefore matched case-insensitively. Registration is game
+ * thread only, lookups work from any thread. Unregistering waits until nobody holds
+ * a removed command any more, so its handler object can be destroyed right after.
+ */
+class UNREALMCP_API FUnrealMCPCommandRegistry
+{
+public:
+    static FUnrealMCPCommandRegistry& Get();
+
+    /** Replaces any handler already registered under the name, with a warning */
+    void RegisterCommand(FName CommandName, const FMCPCommandHandler& Handler, EMCPCommandThread Thread = EMCPCommandThread::GameThread);
+    void UnregisterCommand(FName CommandName);
+
+    /** Removes every command bound to Owner, for handler objects about to be destroyed */
+    void UnregisterAll(const void* Owner);
+
+    /**
+     * Null for unknown commands. Stays valid if the command is unregistered meanwhile, and
+     * unregistering it blocks until the result is released, so hold it while the handler runs
+     */
+    TSharedPtr<const FMCPRegisteredCommand> FindCommand(FName CommandName) const;
+
+    int32 GetNumCommands() const;
+
+private:
+    /** Blocks until every command is referenced only by the caller */
+    static void WaitForRelease(const TArray<TSharedRef<const FMCPRegisteredCommand>>& Removed);
+
+    mutable FRWLock CommandsLock;
+    TMap<FName, TSharedRef<const FMCPRegisteredCommand>> Commands;
+};
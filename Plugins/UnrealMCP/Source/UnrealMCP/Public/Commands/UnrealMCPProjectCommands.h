@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Json.h"
 
+class FUnrealMCPCommandRegistry;
+
 /**
  * Handler class for Project-wide MCP commands
  */
@@ -11,8 +13,8 @@ class UNREALMCP_API FUnrealMCPProjectCommands
 public:
     FUnrealMCPProjectCommands();
 
-    // Handle project commands
-    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+    // Adds every project command to the registry, bound to this instance
+    void RegisterCommands(FUnrealMCPCommandRegistry& Registry);
 
 private:
     // Specific project command handlers
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Json.h"
 
+class FUnrealMCPCommandRegistry;
+
 /**
  * Handles UMG (Widget Blueprint) related MCP commands
  * Responsible for creating and modifying UMG Widget Blueprints,
@@ -13,13 +15,8 @@ class UNREALMCP_API FUnrealMCPUMGCommands
 public:
     FUnrealMCPUMGCommands();
 
-    /**
-     * Handle UMG-related commands
-     * @param CommandType - The type of command to handle
-     * @param Params - JSON parameters for the command
-     * @return JSON response with results or error
-     */
-    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+    /** Adds every UMG command to the registry, bound to this instance */
+    void RegisterCommands(FUnrealMCPCommandRegistry& Registry);
 
 private:
     /**
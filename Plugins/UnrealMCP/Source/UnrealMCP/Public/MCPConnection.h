@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+
+class FSocket;
+class FMCPSocketPoller;
+
+/**
+ * State of one MCP client. Owned by the I/O worker it was handed to,
+ * which is the only thread reading from it.
+ *
+ * Messages are JSON objects framed by their own braces, so clients may send them
+ * newline-delimited or back to back without any separator. A top-level array is
+ * framed the same way so the worker can reject it as a whole. Responses always end in
+ * a newline. The receive buffer grows to fit the largest message and is compacted
+ * lazily, and framing state carries over between reads, so every byte is scanned once.
+ *
+ * Responses go through an outbound queue written as far as the socket accepts and
+ * resumed once it is writable again. A client that lets the queue grow past
+ * MaxPendingSendBytes gets no further requests served until it reads. Requests run
+ * concurrently, so responses are queued from whichever thread completes them.
+ * A client with MaxRequestsInFlight requests running is not read from until one
+ * finishes, which wakes the worker.
+ */
+class FMCPConnection
+{
+public:
+	/** A single message larger than this drops the connection rather than growing the buffer further */
+	static constexpr int32 MaxMessageSize = 64 * 1024 * 1024;
+
+	/** Response bytes queued for a client beyond which its requests are no longer taken */
+	static constexpr int32 MaxPendingSendBytes = 8 * 1024 * 1024;
+
+	/** Requests of one client running at once before the rest wait in the receive buffer */
+	static constexpr int32 MaxRequestsInFlight = 64;
+
+	FMCPConnection(FSocket* InSocket, int32 InId);
+	~FMCPConnection();
+
+	/** Appends whatever the socket has to the receive buffer. Returns false once the client is gone */
+	bool Receive(int32& OutBytesRead);
+
+	/** Takes the next complete message out of the receive buffer */
+	bool PopMessage(FString& OutMessage);
+
+	/** Queues a response, converted to UTF-8 once, and writes as much of the queue as the socket takes. Thread safe */
+	void QueueMessage(const FString& Message);
+
+	/** Writes queued bytes until done or the socket would block. Returns false once the client is gone. Thread safe */
+	bool FlushSend(int32& OutBytesSent);
+
+	int32 GetPendingSendBytes() const;
+	bool IsSendBackedUp() const { return GetPendingSendBytes() > MaxPendingSendBytes; }
+
+	/** Counts a request from dispatch until its response is queued. EndRequest is thread safe and wakes the worker */
+	void BeginRequest() { RequestsInFlight.fetch_add(1, std::memory_order_relaxed); }
+	void EndRequest();
+	bool CanBeginRequest() const { return RequestsInFlight.load(std::memory_order_relaxed) < MaxRequestsInFlight; }
+
+	/** Set by the worker before it serves the connection. Shared, since requests can finish after the worker is gone */
+	void SetPoller(const TSharedPtr<FMCPSocketPoller>& InPoller) { Poller = InPoller; }
+
+	FSocket* GetSocket() const { return Socket; }
+	int32 GetId() const { return Id; }
+
+private:
+	/** Drops the consumed bytes at the front of the buffer once they outweigh the rest */
+	void CompactReceiveBuffer();
+
+	FSocket* Socket;
+	int32 Id;
+
+	/** Bytes received; everything before ReadOffset is consumed */
+	TArray<uint8> ReceiveBuffer;
+	int32 ReadOffset;
+
+	/** Next byte to look at, bytes between ReadOffset and here belong to the frame being scanned */
+	int32 ScanOffset;
+
+	/** Brace and bracket nesting of the frame being scanned, 0 between frames */
+	int32 FrameDepth;
+	bool bInString;
+	bool bEscaped;
+
+	/** Inside a run of bytes between frames that are neither whitespace nor a frame start, logged once per run */
+	bool bSkippingStray;
+
+	/** UTF-8 responses; everything before SendOffset is on the wire. Guarded by SendLock */
+	TArray<uint8> SendBuffer;
+	int32 SendOffset;
+	mutable FCriticalSection SendLock;
+
+	std::atomic<int32> RequestsInFlight;
+	TSharedPtr<FMCPSocketPoller> Poller;
+};
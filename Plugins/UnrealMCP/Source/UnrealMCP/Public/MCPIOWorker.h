@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+#include <atomic>
+
+class UUnrealMCPBridge;
+class FMCPConnection;
+class FRunnableThread;
+class FMCPSocketPoller;
+class FJsonValue;
+
+/**
+ * One thread of the MCP server's I/O pool. Serves every connection handed
+ * to it: reads requests and hands them to the bridge without waiting, so
+ * a client can have many requests in flight. Each response is queued on its
+ * connection as soon as it completes, tagged with the request's "id" if it had one.
+ *
+ * Never sleeps for a fixed time or polls on a timer: once nothing is left to
+ * do it blocks in one FMCPSocketPoller wait over every socket it can make
+ * progress on, which a new connection, a finished request or Stop ends through
+ * the poller's wake socket. An idle worker uses no CPU, clients or not.
+ */
+class FMCPIOWorker : public FRunnable
+{
+public:
+	FMCPIOWorker(UUnrealMCPBridge* InBridge, int32 InIndex);
+	virtual ~FMCPIOWorker();
+
+	/** Thread safe, the worker picks the connection up on its next pass */
+	void AddConnection(TSharedPtr<FMCPConnection> Connection);
+
+	/** Connections served or about to be, for spreading new ones across the pool */
+	int32 GetNumConnections() const { return NumConnections.load(std::memory_order_relaxed); }
+
+	// FRunnable interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+protected:
+	/** Reads and answers whatever every connection has pending. Returns true if any data arrived */
+	bool ServeConnections();
+
+	/** Blocks until a connection is ready or the poller is woken */
+	void WaitForActivity();
+
+	/** Hands every complete message to the bridge while the connection takes requests. Returns true if any was */
+	bool DispatchMessages(const TSharedPtr<FMCPConnection>& Connection);
+
+	void ProcessMessage(const TSharedPtr<FMCPConnection>& Connection, const FString& Message);
+
+	/** Answers a request that could not be dispatched */
+	static void QueueError(FMCPConnection& Connection, const TSharedPtr<FJsonValue>& RequestId, const FString& Error);
+
+private:
+	UUnrealMCPBridge* Bridge;
+	int32 Index;
+	FRunnableThread* Thread;
+	std::atomic<bool> bRunning;
+	std::atomic<int32> NumConnections;
+
+	/** Woken when a connection is added, a request finishes or the worker is stopped. Shared with the connections */
+	TSharedPtr<FMCPSocketPoller> Poller;
+
+	/** Accepted by the listener, not yet picked up */
+	TQueue<TSharedPtr<FMCPConnection>, EQueueMode::Mpsc> PendingConnections;
+
+	/** Only touched by the worker thread */
+	TArray<TSharedPtr<FMCPConnection>> Connections;
+};
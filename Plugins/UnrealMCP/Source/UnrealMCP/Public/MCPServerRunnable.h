@@ -6,13 +6,21 @@
 #include "Interfaces/IPv4/IPv4Address.h"
 
 class UUnrealMCPBridge;
+class FMCPIOWorker;
 
 /**
- * Runnable class for the MCP server thread
+ * Runnable class for the MCP server thread. Accepts clients and hands each
+ * one to the least busy worker of a small I/O pool, which serves it from then on.
  */
 class FMCPServerRunnable : public FRunnable
 {
 public:
+	/** Threads serving client connections */
+	static constexpr int32 NumIOWorkers = 2;
+
+	/** Longest the listener blocks before checking whether it was stopped */
+	static constexpr double ListenWaitSeconds = 0.5;
+
 	FMCPServerRunnable(UUnrealMCPBridge* InBridge, TSharedPtr<FSocket> InListenerSocket);
 	virtual ~FMCPServerRunnable();
 
@@ -23,12 +31,12 @@ public:
 	virtual void Exit() override;
 
 protected:
-	void HandleClientConnection(TSharedPtr<FSocket> ClientSocket);
-	void ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message);
+	void AcceptConnection();
 
 private:
 	UUnrealMCPBridge* Bridge;
 	TSharedPtr<FSocket> ListenerSocket;
-	TSharedPtr<FSocket> ClientSocket;
+	TArray<TUniquePtr<FMCPIOWorker>> Workers;
+	int32 NextConnectionId;
 	bool bRunning;
-}; 
\ No newline at end of file
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+class FSocket;
+class FInternetAddr;
+
+/**
+ * Waits on many sockets at once, which FSocket cannot: it only waits on itself.
+ * Every FSocket on the editor's platforms is a BSD socket, so their native
+ * handles go to the platform's poll in one call.
+ *
+ * A loopback UDP socket is polled alongside them, and Wake sends it a byte, so
+ * another thread can end a wait that has no timeout. Wakes coalesce into a single
+ * datagram until the waiting thread has seen it.
+ */
+class FMCPSocketPoller
+{
+public:
+	FMCPSocketPoller();
+	~FMCPSocketPoller();
+
+	/** Ends the current Wait, or makes the next one return at once. Thread safe */
+	void Wake();
+
+	/** Adds a socket to the next Wait. Only the thread calling Wait may add */
+	void Add(FSocket* Socket, bool bRead, bool bWrite);
+
+	/**
+	 * Blocks until a socket added since the last Wait is ready, Wake is called or the
+	 * timeout runs out, then forgets the added sockets. A negative timeout never runs out
+	 */
+	void Wait(double TimeoutSeconds = -1.0);
+
+private:
+	struct FEntry
+	{
+		FSocket* Socket;
+		bool bRead;
+		bool bWrite;
+	};
+
+	TArray<FEntry> Entries;
+
+	FSocket* WakeSocket;
+	TSharedPtr<FInternetAddr> WakeAddress;
+
+	/** Set by the first Wake after a Wait, so a burst of them sends one datagram */
+	std::atomic<bool> bWakePending;
+};
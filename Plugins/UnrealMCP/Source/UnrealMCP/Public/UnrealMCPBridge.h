@@ -8,20 +8,30 @@
 #include "Json.h"
 #include "Interfaces/IPv4/IPv4Address.h"
 #include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
 #include "Commands/UnrealMCPEditorCommands.h"
 #include "Commands/UnrealMCPBlueprintCommands.h"
 #include "Commands/UnrealMCPBlueprintNodeCommands.h"
 #include "Commands/UnrealMCPProjectCommands.h"
 #include "Commands/UnrealMCPUMGCommands.h"
+#include "Commands/UnrealMCPCommandRegistry.h"
+#include <atomic>
 #include "UnrealMCPBridge.generated.h"
 
 class FMCPServerRunnable;
 
+/** Receives the full response of an asynchronously executed command, with its "status" and "result" or "error" */
+using FMCPCommandCompletion = TUniqueFunction<void(const TSharedRef<FJsonObject>& /*Response*/)>;
+
 /**
  * Editor subsystem for MCP Bridge
  * Handles communication between external tools and the Unreal Editor
- * through a TCP socket connection. Commands are received as JSON and
- * routed to appropriate command handlers.
+ * through a TCP socket connection, any number of clients at once.
+ * Commands are received as JSON and routed to the handler registered for them
+ * in FUnrealMCPCommandRegistry. Game thread commands wait in a queue drained once
+ * per frame under a time budget, so bursts of automation never stall the editor;
+ * commands registered as thread safe skip the queue and run on a task graph worker.
  */
 UCLASS()
 class UNREALMCP_API UUnrealMCPBridge : public UEditorSubsystem
@@ -40,21 +50,67 @@ public:
 	void StartServer();
 	void StopServer();
 	bool IsRunning() const { return bIsRunning; }
+	const FIPv4Address& GetServerAddress() const { return ServerAddress; }
+	uint16 GetPort() const { return Port; }
+
+	// Command execution. Runs the command where it was registered to run and calls OnComplete there with the response; returns straight away
+	void ExecuteCommandAsync(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, FMCPCommandCompletion&& OnComplete);
 
-	// Command execution
-	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+	// Single line JSON of a response, as sent to clients
+	static FString SerializeResponse(const TSharedRef<FJsonObject>& ResponseJson);
 
 private:
+	// Routes a command to its handler and wraps the result into a response; game thread only
+	TSharedRef<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+	// Runs a handler and wraps its result into a response, on whatever thread calls it
+	static TSharedRef<FJsonObject> RunHandler(const FMCPCommandHandler& Handler, const TSharedPtr<FJsonObject>& Params);
+
+	// Adds the "timing" object to a response and counts it into the totals
+	void RecordTiming(const TSharedRef<FJsonObject>& ResponseJson, double QueueWait, double Execution);
+
+	TSharedPtr<FJsonObject> HandlePing(const TSharedPtr<FJsonObject>& Params);
+	TSharedPtr<FJsonObject> HandleGetServerStats(const TSharedPtr<FJsonObject>& Params);
+
+	// Runs the "commands" array of a batch in order within the current game thread task
+	TSharedRef<FJsonObject> HandleBatch(const TSharedPtr<FJsonObject>& Params);
+
+	// A command waiting for the game thread
+	struct FQueuedCommand
+	{
+		FString CommandType;
+		TSharedPtr<FJsonObject> Params;
+		FMCPCommandCompletion OnComplete;
+		double QueuedTime;
+	};
+
+	// Runs queued commands until MCP.CommandBudgetMs is used up for this frame, the rest wait for the next one
+	bool DrainCommandQueue(float DeltaTime);
+
 	// Server state
 	bool bIsRunning;
 	TSharedPtr<FSocket> ListenerSocket;
-	TSharedPtr<FSocket> ConnectionSocket;
 	FRunnableThread* ServerThread;
 
 	// Server configuration
 	FIPv4Address ServerAddress;
 	uint16 Port;
 
+	// Filled from any thread, drained on the game thread by the core ticker
+	TQueue<FQueuedCommand, EQueueMode::Mpsc> CommandQueue;
+	std::atomic<int32> NumQueuedCommands{0};
+
+	// Thread safe commands still running on task graph workers, which use this bridge until they end
+	std::atomic<int32> NumRunningTasks{0};
+	FTSTicker::FDelegateHandle DrainTickerHandle;
+
+	// Totals since startup, guarded by StatsLock as thread safe commands add to them too
+	mutable FCriticalSection StatsLock;
+	int64 NumExecutedCommands = 0;
+	double TotalQueueWaitSeconds = 0.0;
+	double MaxQueueWaitSeconds = 0.0;
+	double TotalExecutionSeconds = 0.0;
+
 	// Command handler instances
 	TSharedPtr<FUnrealMCPEditorCommands> EditorCommands;
 	TSharedPtr<FUnrealMCPBlueprintCommands> BlueprintCommands;
@@ -1,5 +1,6 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
+using System.IO;
 using UnrealBuildTool;
 
 public class UnrealMCP : ModuleRules
@@ -18,7 +19,8 @@ public class UnrealMCP : ModuleRules
 		
 		PrivateIncludePaths.AddRange(
 			new string[] {
-				// ... add other private include paths required here ...
+				// FSocketBSD, so the I/O workers can poll the native handles of many sockets at once
+				Path.Combine(EngineDirectory, "Source", "Runtime", "Sockets", "Private"),
 			}
 		);
 		
@@ -14,6 +14,8 @@ public class MineSweep : ModuleRules
 			"Engine", 
 			"InputCore", 
 			"EnhancedInput",
+			"NetCore",
+			"MinesweeperCore",
             "Slate",
 			"SlateCore",
 			"EditorStyle"
@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "MineSweepCharacter.h"
+#include "MinefieldActor.h"
+#include "EngineUtils.h"
 #include "Engine/LocalPlayer.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -127,3 +129,48 @@ void AMineSweepCharacter::Look(const FInputActionValue& Value)
 		AddControllerPitchInput(LookAxisVector.Y);
 	}
 }
+
+//////////////////////////////////////////////////////////////////////////
+// Minefield
+
+void AMineSweepCharacter::BeginPlay()
+{
+	Super::BeginPlay();
+
+	TActorIterator<AMinefieldActor> It(GetWorld());
+	Minefield = It ? *It : nullptr;
+}
+
+void AMineSweepCharacter::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	// A replicated field is only played on the server, which moves every player; a local one by its own player
+	AMinefieldActor* Field = Minefield.Get();
+	if (!Field || !(Field->GetIsReplicated() ? HasAuthority() : IsLocallyControlled()))
+	{
+		return;
+	}
+
+	if (!GetCharacterMovement()->IsMovingOnGround())
+	{
+		LastStepLocation.Reset();
+		return;
+	}
+
+	// Tiles come from the location alone, there are no per-tile triggers to overlap
+	const FVector Location = GetActorLocation();
+	if (LastStepLocation.IsSet())
+	{
+		Field->StepAlong(LastStepLocation.GetValue(), Location);
+	}
+	else
+	{
+		FIntPoint Tile;
+		if (Field->WorldToTile(Location, Tile))
+		{
+			Field->RevealTile(Tile.X, Tile.Y);
+		}
+	}
+	LastStepLocation = Location;
+}
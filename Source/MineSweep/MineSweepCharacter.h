@@ -11,6 +11,7 @@ class USpringArmComponent;
 class UCameraComponent;
 class UInputMappingContext;
 class UInputAction;
+class AMinefieldActor;
 struct FInputActionValue;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogTemplateCharacter, Log, All);
@@ -63,6 +64,18 @@ protected:
 
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
+	virtual void BeginPlay() override;
+
+	/** Reveals the minefield tiles walked onto since the last tick */
+	virtual void Tick(float DeltaSeconds) override;
+
+private:
+	/** Field the character walks on, the first one in the level */
+	TWeakObjectPtr<AMinefieldActor> Minefield;
+
+	/** Where the last tick left off, unset while airborne so a jump only triggers the landing tile */
+	TOptional<FVector> LastStepLocation;
+
 public:
 	/** Returns CameraBoom subobject **/
 	FORCEINLINE class USpringArmComponent* GetCameraBoom() const { return CameraBoom; }
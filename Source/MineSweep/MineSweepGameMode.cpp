@@ -2,6 +2,8 @@
 
 #include "MineSweepGameMode.h"
 #include "MineSweepCharacter.h"
+#include "StreamedMinefieldActor.h"
+#include "EngineUtils.h"
 #include "UObject/ConstructorHelpers.h"
 
 AMineSweepGameMode::AMineSweepGameMode()
@@ -13,3 +15,27 @@ AMineSweepGameMode::AMineSweepGameMode()
 		DefaultPawnClass = PlayerPawnBPClass.Class;
 	}
 }
+
+void AMineSweepGameMode::StartPlay()
+{
+	Super::StartPlay();
+
+	// Each machine streams chunks around its own players, the radii reach clients with the field
+	for (TActorIterator<AStreamedMinefieldActor> It(GetWorld()); It; ++It)
+	{
+		It->LoadRadius = ChunkLoadRadius;
+		It->UnloadRadius = FMath::Max(ChunkUnloadRadius, ChunkLoadRadius);
+		StreamedMinefields.Add(*It);
+	}
+}
+
+void AMineSweepGameMode::RestartMinefields(int32 Seed)
+{
+	for (const TWeakObjectPtr<AStreamedMinefieldActor>& Minefield : StreamedMinefields)
+	{
+		if (AStreamedMinefieldActor* Field = Minefield.Get())
+		{
+			Field->NewGame(Seed != 0 ? Seed : FMath::Rand());
+		}
+	}
+}
@@ -6,6 +6,13 @@
 #include "GameFramework/GameModeBase.h"
 #include "MineSweepGameMode.generated.h"
 
+class AStreamedMinefieldActor;
+
+/**
+ * Hosts the streamed minefields of the level. The board is server authoritative:
+ * only the server's characters reveal tiles and clients follow through replication,
+ * so a session is a shared game whether played standalone, listen server or dedicated.
+ */
 UCLASS(minimalapi)
 class AMineSweepGameMode : public AGameModeBase
 {
@@ -13,7 +20,21 @@ class AMineSweepGameMode : public AGameModeBase
 
 public:
 	AMineSweepGameMode();
-};
 
+	/** Chunks of streamed minefields closer than this to a player's pawn get their instanced meshes */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield, meta = (ClampMin = "0.0"))
+	float ChunkLoadRadius = 6000.0f;
+
+	/** Loaded chunks are dropped past this distance. Kept above the load radius so walking along a chunk border does not thrash */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield, meta = (ClampMin = "0.0"))
+	float ChunkUnloadRadius = 8000.0f;
 
+	virtual void StartPlay() override;
 
+	/** Starts a new shared game on every streamed minefield, 0 picks a random seed */
+	UFUNCTION(BlueprintCallable, Category = Minefield)
+	void RestartMinefields(int32 Seed);
+
+private:
+	TArray<TWeakObjectPtr<AStreamedMinefieldActor>> StreamedMinefields;
+};
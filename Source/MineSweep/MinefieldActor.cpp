@@ -0,0 +1,251 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MinefieldActor.h"
+#include "MinesweeperBoard.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "UObject/ConstructorHelpers.h"
+
+AMinefieldActor::AMinefieldActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+
+	Tiles = CreateDefaultSubobject<UHierarchicalInstancedStaticMeshComponent>(TEXT("Tiles"));
+	Tiles->SetupAttachment(RootComponent);
+	Tiles->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Tiles->SetCastShadow(false);
+
+	// The tile state code, see EMinefieldTileVisual
+	Tiles->NumCustomDataFloats = 1;
+
+	static ConstructorHelpers::FObjectFinder<UStaticMesh> TileMesh(TEXT("/Game/LevelPrototyping/Meshes/SM_ChamferCube.SM_ChamferCube"));
+	if (TileMesh.Succeeded())
+	{
+		Tiles->SetStaticMesh(TileMesh.Object);
+	}
+}
+
+void AMinefieldActor::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+	// Also runs for every property edit in the level, so the field previews at its final size
+	ApplyTileMaterial();
+	RebuildInstances();
+}
+
+void AMinefieldActor::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// Actors loaded with the level in a cooked game skip OnConstruction
+	ApplyTileMaterial();
+}
+
+void AMinefieldActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!TileMaterial)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s has no TileMaterial, its tiles will not show their state"), *GetName());
+	}
+
+	NewGame(Seed != 0 ? Seed : FMath::Rand());
+}
+
+void AMinefieldActor::NewGame(int32 InSeed)
+{
+	Board = FMinesweeperBoard::Generate(Width, Height, BombCount, InSeed);
+
+	const int32 NumTiles = Board->GetNumTiles();
+	if (Tiles->GetInstanceCount() != NumTiles)
+	{
+		RebuildInstances();
+	}
+
+	for (int32 Index = 0; Index < NumTiles; Index++)
+	{
+		SetTileVisual(Index, uint8(EMinefieldTileVisual::Hidden));
+	}
+	Tiles->MarkRenderStateDirty();
+}
+
+bool AMinefieldActor::RevealTile(int32 X, int32 Y)
+{
+	if (!Board.IsValid() || !Board->IsValidTile(X, Y) || Board->GetStatus() != EMinesweeperGameStatus::Playing)
+	{
+		return false;
+	}
+
+	TArray<int32> Revealed;
+	const EMinesweeperGameStatus Status = Board->Reveal(X, Y, &Revealed);
+	if (Revealed.Num() == 0)
+	{
+		return false;
+	}
+
+	// Only the revealed instances change, a flood fill over a large opening is still one render state update
+	for (int32 Index : Revealed)
+	{
+		SetTileVisual(Index, GetTileVisual(Index));
+	}
+
+	if (Status == EMinesweeperGameStatus::Lost)
+	{
+		for (int32 Index = 0; Index < Board->GetNumTiles(); Index++)
+		{
+			if (Board->IsBomb(Index) && Board->GetCellState(Index) != EMinesweeperCellState::Revealed)
+			{
+				SetTileVisual(Index, uint8(EMinefieldTileVisual::Bomb));
+			}
+		}
+	}
+
+	Tiles->MarkRenderStateDirty();
+	return true;
+}
+
+bool AMinefieldActor::ToggleFlag(int32 X, int32 Y)
+{
+	if (!Board.IsValid() || Board->GetStatus() != EMinesweeperGameStatus::Playing || !Board->ToggleFlag(X, Y))
+	{
+		return false;
+	}
+
+	const int32 Index = Board->ToIndex(X, Y);
+	SetTileVisual(Index, GetTileVisual(Index));
+	Tiles->MarkRenderStateDirty();
+	return true;
+}
+
+int32 AMinefieldActor::StepAlong(const FVector& FromWorld, const FVector& ToWorld)
+{
+	// Everything below is in tile units, one grid line per whole number
+	const FVector2D From = FVector2D(GetActorTransform().InverseTransformPosition(FromWorld)) / TileSize;
+	const FVector2D To = FVector2D(GetActorTransform().InverseTransformPosition(ToWorld)) / TileSize;
+
+	FIntPoint Tile(FMath::FloorToInt(From.X), FMath::FloorToInt(From.Y));
+	const FIntPoint End(FMath::FloorToInt(To.X), FMath::FloorToInt(To.Y));
+
+	const int32 NumSteps = FMath::Abs(End.X - Tile.X) + FMath::Abs(End.Y - Tile.Y);
+	if (NumSteps == 0)
+	{
+		return 0;
+	}
+	if (NumSteps > MaxStepTiles)
+	{
+		return RevealTile(End.X, End.Y) ? 1 : 0;
+	}
+
+	// Amanatides-Woo: NextX/NextY are the path fractions where the next vertical/horizontal grid line is crossed
+	const FVector2D Delta = To - From;
+	const int32 StepX = Delta.X > 0.0 ? 1 : -1;
+	const int32 StepY = Delta.Y > 0.0 ? 1 : -1;
+	const double SpanX = Delta.X != 0.0 ? FMath::Abs(1.0 / Delta.X) : UE_BIG_NUMBER;
+	const double SpanY = Delta.Y != 0.0 ? FMath::Abs(1.0 / Delta.Y) : UE_BIG_NUMBER;
+	double NextX = Delta.X != 0.0 ? ((StepX > 0 ? Tile.X + 1 : Tile.X) - From.X) / Delta.X : UE_BIG_NUMBER;
+	double NextY = Delta.Y != 0.0 ? ((StepY > 0 ? Tile.Y + 1 : Tile.Y) - From.Y) / Delta.Y : UE_BIG_NUMBER;
+
+	int32 NumChanged = 0;
+	for (int32 Step = 0; Step < NumSteps; Step++)
+	{
+		// An axis that already reached the end tile never steps again, whatever rounding did to its crossing
+		const bool bStepX = Tile.Y == End.Y || (Tile.X != End.X && NextX < NextY);
+		if (bStepX)
+		{
+			Tile.X += StepX;
+			NextX += SpanX;
+		}
+		else
+		{
+			Tile.Y += StepY;
+			NextY += SpanY;
+		}
+
+		NumChanged += RevealTile(Tile.X, Tile.Y) ? 1 : 0;
+	}
+	return NumChanged;
+}
+
+bool AMinefieldActor::WorldToTile(const FVector& WorldLocation, FIntPoint& OutTile) const
+{
+	// Tile (0, 0) starts at the actor origin and the field grows along local +X and +Y
+	const FVector Local = GetActorTransform().InverseTransformPosition(WorldLocation);
+	OutTile = FIntPoint(FMath::FloorToInt(Local.X / TileSize), FMath::FloorToInt(Local.Y / TileSize));
+	return OutTile.X >= 0 && OutTile.Y >= 0 && OutTile.X < Width && OutTile.Y < Height;
+}
+
+FVector AMinefieldActor::GetTileCenter(int32 X, int32 Y) const
+{
+	return GetActorTransform().TransformPosition(FVector((X + 0.5f) * TileSize, (Y + 0.5f) * TileSize, 0.0f));
+}
+
+void AMinefieldActor::ApplyTileMaterial()
+{
+	if (TileMaterial)
+	{
+		Tiles->SetMaterial(0, TileMaterial);
+	}
+}
+
+void AMinefieldActor::RebuildInstances()
+{
+	Tiles->ClearInstances();
+
+	if (!Tiles->GetStaticMesh())
+	{
+		return;
+	}
+
+	TArray<FTransform> Transforms;
+	Transforms.Reserve(Width * Height);
+	for (int32 Y = 0; Y < Height; Y++)
+	{
+		for (int32 X = 0; X < Width; X++)
+		{
+			Transforms.Add(GetTileTransform(X, Y));
+		}
+	}
+
+	// One batched add builds the cluster tree once instead of per instance
+	Tiles->AddInstances(Transforms, false);
+
+	for (int32 Index = 0; Index < Transforms.Num(); Index++)
+	{
+		SetTileVisual(Index, Board.IsValid() && Board->IsValidIndex(Index) ? GetTileVisual(Index) : uint8(EMinefieldTileVisual::Hidden));
+	}
+	Tiles->MarkRenderStateDirty();
+}
+
+FTransform AMinefieldActor::GetTileTransform(int32 X, int32 Y) const
+{
+	// Scale the mesh to the tile footprint whatever its authored size, with the top face just above the floor
+	const FBox MeshBounds = Tiles->GetStaticMesh()->GetBoundingBox();
+	const FVector MeshSize = MeshBounds.GetSize().ComponentMax(FVector(UE_KINDA_SMALL_NUMBER));
+	const float Footprint = TileSize * (1.0f - TileGap);
+	const FVector Scale(Footprint / MeshSize.X, Footprint / MeshSize.Y, TileHeight / MeshSize.Z);
+
+	const FVector Center((X + 0.5f) * TileSize, (Y + 0.5f) * TileSize, 0.5f * TileHeight);
+	return FTransform(FQuat::Identity, Center - MeshBounds.GetCenter() * Scale, Scale);
+}
+
+void AMinefieldActor::SetTileVisual(int32 Index, uint8 Visual)
+{
+	Tiles->SetCustomDataValue(Index, 0, Visual, false);
+}
+
+uint8 AMinefieldActor::GetTileVisual(int32 Index) const
+{
+	switch (Board->GetCellState(Index))
+	{
+	case EMinesweeperCellState::Flagged:
+		return uint8(EMinefieldTileVisual::Flagged);
+	case EMinesweeperCellState::Revealed:
+		return Board->IsBomb(Index) ? uint8(EMinefieldTileVisual::Exploded) : uint8(Board->GetAdjacentBombs(Index));
+	default:
+		return uint8(EMinefieldTileVisual::Hidden);
+	}
+}
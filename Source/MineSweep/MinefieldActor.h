@@ -0,0 +1,131 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "MinesweeperBoardFwd.h"
+#include "MinefieldActor.generated.h"
+
+class UHierarchicalInstancedStaticMeshComponent;
+class UMaterialInterface;
+
+/**
+ * What a tile shows, written to per-instance custom data float 0 for the material.
+ * Same codes as the editor tool's board snapshots: 0-8 are revealed numbers.
+ */
+enum class EMinefieldTileVisual : uint8
+{
+	Hidden = 9,
+	Flagged,
+	Exploded,
+	Bomb
+};
+
+/**
+ * A board laid out on the level floor. Every tile is one instance of a single
+ * hierarchical instanced mesh and its state lives in per-instance custom data,
+ * so even a 256x256 field is a few draw calls and no per-tile UObjects.
+ * Instance index and board index are the same, row-major from the actor origin.
+ * The whole board is generated at BeginPlay; for fields too large for that use
+ * AStreamedMinefieldActor, which builds on the same layout and stepping logic.
+ */
+UCLASS()
+class AMinefieldActor : public AActor
+{
+	GENERATED_BODY()
+
+	/** All tiles, one instance each. Has no collision, the floor underneath carries the player */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Minefield, meta = (AllowPrivateAccess = "true"))
+	UHierarchicalInstancedStaticMeshComponent* Tiles;
+
+public:
+	AMinefieldActor();
+
+	/** The whole board is generated up front, so it is capped; AStreamedMinefieldActor sets its own size */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield, meta = (ClampMin = "2", ClampMax = "1024"))
+	int32 Width = 16;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield, meta = (ClampMin = "2", ClampMax = "1024"))
+	int32 Height = 16;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield, meta = (ClampMin = "1"))
+	int32 BombCount = 40;
+
+	/** Layout used at BeginPlay, 0 picks a random one */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield)
+	int32 Seed = 0;
+
+	/** World units from one tile centre to the next */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield, meta = (ClampMin = "1.0"))
+	float TileSize = 100.0f;
+
+	/** Space left between neighbouring tiles, as a fraction of TileSize */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield, meta = (ClampMin = "0.0", ClampMax = "0.5"))
+	float TileGap = 0.05f;
+
+	/** Paths crossing more tiles than this are treated as a teleport and only reveal where they end */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield, meta = (ClampMin = "1"))
+	int32 MaxStepTiles = 64;
+
+	/** Tile thickness in world units */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield, meta = (ClampMin = "0.1"))
+	float TileHeight = 4.0f;
+
+	/**
+	 * Material of every tile. The tile state is only in PerInstanceCustomData[0], one of the
+	 * EMinefieldTileVisual codes, so the material must read it to pick a colour or atlas cell;
+	 * without one all tiles look the same whatever their state.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield)
+	UMaterialInterface* TileMaterial = nullptr;
+
+	/** Lays out a new board and hides every tile again */
+	UFUNCTION(BlueprintCallable, Category = Minefield)
+	virtual void NewGame(int32 InSeed);
+
+	/** Reveals a tile with the usual flood fill. Returns false if nothing changed */
+	UFUNCTION(BlueprintCallable, Category = Minefield)
+	virtual bool RevealTile(int32 X, int32 Y);
+
+	UFUNCTION(BlueprintCallable, Category = Minefield)
+	virtual bool ToggleFlag(int32 X, int32 Y);
+
+	/**
+	 * Reveals every tile entered on the straight path between two world locations,
+	 * not counting the tile From is on. Walks the grid lines the path crosses, so
+	 * the cost depends on the distance moved and not on the size of the field.
+	 * Returns the number of tiles that changed.
+	 */
+	int32 StepAlong(const FVector& FromWorld, const FVector& ToWorld);
+
+	/** Tile under a world location, ignoring height. Returns false outside the field */
+	bool WorldToTile(const FVector& WorldLocation, FIntPoint& OutTile) const;
+
+	FVector GetTileCenter(int32 X, int32 Y) const;
+
+	/** Null until the first game has been laid out, and always for streamed fields */
+	const FMinesweeperBoard* GetBoard() const { return Board.Get(); }
+
+protected:
+	virtual void OnConstruction(const FTransform& Transform) override;
+	virtual void PostInitializeComponents() override;
+	virtual void BeginPlay() override;
+
+	/** Puts TileMaterial on the tiles, before any instances or chunk components copy it */
+	void ApplyTileMaterial();
+
+	/** Recreates one instance per tile, only needed when the field size or spacing changes */
+	virtual void RebuildInstances();
+
+	/** Instance transform of the tile at local offset (X, Y) tiles from the component's origin */
+	FTransform GetTileTransform(int32 X, int32 Y) const;
+
+	UHierarchicalInstancedStaticMeshComponent* GetTiles() const { return Tiles; }
+
+private:
+	void SetTileVisual(int32 Index, uint8 Visual);
+	uint8 GetTileVisual(int32 Index) const;
+
+	TSharedPtr<FMinesweeperBoard> Board;
+};
@@ -0,0 +1,694 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StreamedMinefieldActor.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/PlayerController.h"
+#include "Net/UnrealNetwork.h"
+
+namespace StreamedMinefieldActor
+{
+	uint32 Mix(uint32 Value)
+	{
+		Value ^= Value >> 16;
+		Value *= 0x7feb352du;
+		Value ^= Value >> 15;
+		Value *= 0x846ca68bu;
+		Value ^= Value >> 16;
+		return Value;
+	}
+
+	uint32 HashTile(int32 Seed, int32 X, int32 Y)
+	{
+		return Mix(Mix(Mix(uint32(Seed)) ^ uint32(X)) ^ uint32(Y));
+	}
+
+	// Also enforced at runtime, a density set from Blueprint skips the property's ClampMin
+	constexpr double MinBombDensity = 0.12;
+	constexpr double MaxBombDensity = 0.9;
+
+	constexpr uint8 HiddenPair = uint8(EMinefieldTileVisual::Hidden) | (uint8(EMinefieldTileVisual::Hidden) << 4);
+
+	EMinefieldRunKind GetRunKind(uint8 Code)
+	{
+		if (Code == uint8(EMinefieldTileVisual::Hidden))
+		{
+			return EMinefieldRunKind::Hidden;
+		}
+		return Code == uint8(EMinefieldTileVisual::Flagged) ? EMinefieldRunKind::Flagged : EMinefieldRunKind::Revealed;
+	}
+
+	void WriteVarInt(TArray<uint8>& Out, uint32 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Out.Add(uint8(Value | 0x80));
+			Value >>= 7;
+		}
+		Out.Add(uint8(Value));
+	}
+
+	bool ReadVarInt(const TArray<uint8>& In, int32& Offset, uint32& OutValue)
+	{
+		OutValue = 0;
+		for (int32 Shift = 0; Shift < 32 && Offset < In.Num(); Shift += 7)
+		{
+			const uint8 Byte = In[Offset++];
+			OutValue |= uint32(Byte & 0x7f) << Shift;
+			if (!(Byte & 0x80))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+void FMinefieldChunkItem::EncodeRuns(TConstArrayView<EMinefieldRunKind> TileKinds)
+{
+	using namespace StreamedMinefieldActor;
+
+	Runs.Reset();
+	if (TileKinds.Num() == 0)
+	{
+		return;
+	}
+
+	// Openings are contiguous, so a chunk is a few runs per row at most whatever was revealed
+	EMinefieldRunKind RunKind = TileKinds[0];
+	uint32 RunLength = 0;
+	for (EMinefieldRunKind Kind : TileKinds)
+	{
+		if (Kind != RunKind)
+		{
+			WriteVarInt(Runs, RunLength << 2 | uint32(RunKind));
+			RunKind = Kind;
+			RunLength = 0;
+		}
+		RunLength++;
+	}
+	WriteVarInt(Runs, RunLength << 2 | uint32(RunKind));
+}
+
+bool FMinefieldChunkItem::DecodeRuns(int32 NumTiles, TArray<EMinefieldRunKind>& OutTileKinds) const
+{
+	using namespace StreamedMinefieldActor;
+
+	OutTileKinds.Reset(NumTiles);
+	int32 Offset = 0;
+	uint32 Run = 0;
+	while (Offset < Runs.Num())
+	{
+		// A varint cut off by the end of the buffer fails here rather than reading past it
+		if (!ReadVarInt(Runs, Offset, Run))
+		{
+			return false;
+		}
+
+		const uint32 Kind = Run & 3;
+		const uint32 Length = Run >> 2;
+		if (Kind > uint32(EMinefieldRunKind::Flagged) || Length == 0 || Length > uint32(NumTiles - OutTileKinds.Num()))
+		{
+			return false;
+		}
+		const int32 Start = OutTileKinds.AddUninitialized(Length);
+		FMemory::Memset(OutTileKinds.GetData() + Start, uint8(Kind), Length);
+	}
+	return OutTileKinds.Num() == NumTiles;
+}
+
+void FMinefieldChunkItem::PostReplicatedAdd(const FMinefieldChunkArray& InArraySerializer)
+{
+	InArraySerializer.Owner->ReceivedChunks.Add(Chunk);
+}
+
+void FMinefieldChunkItem::PostReplicatedChange(const FMinefieldChunkArray& InArraySerializer)
+{
+	InArraySerializer.Owner->ReceivedChunks.Add(Chunk);
+}
+
+AStreamedMinefieldActor::AStreamedMinefieldActor()
+{
+	PrimaryActorTick.bCanEverTick = true;
+
+	// The field spans far beyond any distance based relevancy check from its origin
+	bReplicates = true;
+	bAlwaysRelevant = true;
+
+	ChunkArray.Owner = this;
+
+	Width = FieldWidth;
+	Height = FieldHeight;
+}
+
+void AStreamedMinefieldActor::OnConstruction(const FTransform& Transform)
+{
+	Width = FieldWidth;
+	Height = FieldHeight;
+
+	Super::OnConstruction(Transform);
+}
+
+void AStreamedMinefieldActor::PostInitializeComponents()
+{
+	// Level-loaded actors skip OnConstruction in a cooked game
+	Width = FieldWidth;
+	Height = FieldHeight;
+
+	Super::PostInitializeComponents();
+}
+
+void AStreamedMinefieldActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AStreamedMinefieldActor, LoadRadius);
+	DOREPLIFETIME(AStreamedMinefieldActor, UnloadRadius);
+	DOREPLIFETIME(AStreamedMinefieldActor, Game);
+	DOREPLIFETIME(AStreamedMinefieldActor, ChunkArray);
+}
+
+void AStreamedMinefieldActor::NewGame(int32 InSeed)
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	Game.Round++;
+	Game.Seed = InSeed;
+	Game.BombThreshold = uint32(FMath::Clamp(double(BombDensity), StreamedMinefieldActor::MinBombDensity, StreamedMinefieldActor::MaxBombDensity) * double(MAX_uint32));
+	Game.SafeTile = FIntPoint(INDEX_NONE);
+	bLost = false;
+	ChunkStates.Empty();
+	PendingReveals.Reset();
+
+	ChunkArray.Items.Reset();
+	ChunkArray.MarkArrayDirty();
+	ChunkItemIndices.Reset();
+
+	// Loaded chunks are refilled in place, so starting over does not wait for the streamer
+	RebuildInstances();
+}
+
+bool AStreamedMinefieldActor::RevealTile(int32 X, int32 Y)
+{
+	if (!HasAuthority() || bLost || X < 0 || Y < 0 || X >= Width || Y >= Height || GetTileCode(X, Y) != uint8(EMinefieldTileVisual::Hidden))
+	{
+		return false;
+	}
+
+	if (Game.SafeTile.X == INDEX_NONE)
+	{
+		Game.SafeTile = FIntPoint(X, Y);
+	}
+
+	PendingReveals.Add(FIntPoint(X, Y));
+	ContinueReveal();
+	return true;
+}
+
+void AStreamedMinefieldActor::ContinueReveal()
+{
+	// Same flood fill as the board engine, but reading bombs from the hash and writing straight into chunk state.
+	// Budgeted per tick, so even a huge opening never holds up a frame and the clients see it spread
+	while (PendingReveals.Num() > 0 && RevealBudget > 0 && !bLost)
+	{
+		const FIntPoint Tile = PendingReveals.Pop(EAllowShrinking::No);
+		if (GetTileCode(Tile.X, Tile.Y) != uint8(EMinefieldTileVisual::Hidden))
+		{
+			continue;
+		}
+
+		if (IsBomb(Tile.X, Tile.Y))
+		{
+			SetTileCode(Tile.X, Tile.Y, uint8(EMinefieldTileVisual::Exploded));
+			continue;
+		}
+
+		const int32 Adjacent = CountAdjacentBombs(Tile.X, Tile.Y);
+		SetTileCode(Tile.X, Tile.Y, uint8(Adjacent));
+		RevealBudget--;
+		if (Adjacent != 0)
+		{
+			continue;
+		}
+
+		for (int32 NY = FMath::Max(Tile.Y - 1, 0); NY <= FMath::Min(Tile.Y + 1, Height - 1); NY++)
+		{
+			for (int32 NX = FMath::Max(Tile.X - 1, 0); NX <= FMath::Min(Tile.X + 1, Width - 1); NX++)
+			{
+				if (GetTileCode(NX, NY) == uint8(EMinefieldTileVisual::Hidden))
+				{
+					PendingReveals.Add(FIntPoint(NX, NY));
+				}
+			}
+		}
+	}
+
+	if (bLost)
+	{
+		PendingReveals.Reset();
+	}
+
+	FlushDirtyChunks();
+}
+
+bool AStreamedMinefieldActor::ToggleFlag(int32 X, int32 Y)
+{
+	if (!HasAuthority() || bLost || X < 0 || Y < 0 || X >= Width || Y >= Height)
+	{
+		return false;
+	}
+
+	const uint8 Code = GetTileCode(X, Y);
+	if (Code == uint8(EMinefieldTileVisual::Hidden))
+	{
+		SetTileCode(X, Y, uint8(EMinefieldTileVisual::Flagged));
+	}
+	else if (Code == uint8(EMinefieldTileVisual::Flagged))
+	{
+		SetTileCode(X, Y, uint8(EMinefieldTileVisual::Hidden));
+	}
+	else
+	{
+		return false;
+	}
+
+	FlushDirtyChunks();
+	return true;
+}
+
+void AStreamedMinefieldActor::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	RevealBudget = MaxRevealsPerTick;
+	if (HasAuthority() && PendingReveals.Num() > 0)
+	{
+		ContinueReveal();
+	}
+
+	// Chunk meshes are presentation only, so each machine streams for its own players and a dedicated server for none
+	TArray<FVector, TInlineAllocator<4>> Viewers;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (PlayerController && PlayerController->IsLocalController() && PlayerController->GetPawn())
+		{
+			Viewers.Add(PlayerController->GetPawn()->GetActorLocation());
+		}
+	}
+	UpdateStreaming(Viewers);
+}
+
+void AStreamedMinefieldActor::PostNetReceive()
+{
+	Super::PostNetReceive();
+
+	// Applied here rather than per item, so the seed and safe tile of the same update are already in
+	const bool bNewRound = AppliedRound != Game.Round;
+	if (bNewRound)
+	{
+		AppliedRound = Game.Round;
+		bLost = false;
+		ChunkStates.Empty();
+		DirtyChunks.Reset();
+		for (const FMinefieldChunkItem& Item : ChunkArray.Items)
+		{
+			ReceivedChunks.Add(Item.Chunk);
+		}
+	}
+
+	if (ReceivedChunks.Num() > 0)
+	{
+		for (const FMinefieldChunkItem& Item : ChunkArray.Items)
+		{
+			if (ReceivedChunks.Contains(Item.Chunk))
+			{
+				DecodeChunk(Item);
+			}
+		}
+		ReceivedChunks.Reset();
+	}
+
+	if (bNewRound)
+	{
+		RebuildInstances();
+	}
+	else
+	{
+		FlushDirtyChunks();
+	}
+}
+
+void AStreamedMinefieldActor::UpdateStreaming(TConstArrayView<FVector> ViewerLocations)
+{
+	if (!GetTiles()->GetStaticMesh())
+	{
+		return;
+	}
+
+	const double ChunkWorldSize = double(TileSize) * ChunkSize;
+	const FIntPoint NumChunks = GetNumChunks();
+
+	// Viewers in actor space, where tile (0, 0) starts at the origin
+	TArray<FVector2D, TInlineAllocator<8>> Viewers;
+	for (const FVector& Location : ViewerLocations)
+	{
+		Viewers.Add(FVector2D(GetActorTransform().InverseTransformPosition(Location)));
+	}
+
+	auto GetDistanceSquared = [this, ChunkWorldSize](const FIntPoint& Chunk, const FVector2D& Viewer)
+	{
+		const FVector2D Min = FVector2D(Chunk) * ChunkWorldSize;
+		return FBox2D(Min, Min + FVector2D(GetChunkExtent(Chunk)) * TileSize).ComputeSquaredDistanceToPoint(Viewer);
+	};
+
+	// Unload first, so a teleport hands its components straight to the chunks it needs
+	TArray<FIntPoint, TInlineAllocator<64>> Unwanted;
+	for (const TPair<FIntPoint, UHierarchicalInstancedStaticMeshComponent*>& Pair : LoadedChunks)
+	{
+		const bool bNear = Viewers.ContainsByPredicate([&](const FVector2D& Viewer)
+		{
+			return GetDistanceSquared(Pair.Key, Viewer) <= FMath::Square(FMath::Max(UnloadRadius, LoadRadius));
+		});
+		if (!bNear)
+		{
+			Unwanted.Add(Pair.Key);
+		}
+	}
+	for (const FIntPoint& Chunk : Unwanted)
+	{
+		UnloadChunk(Chunk);
+	}
+
+	// Only the chunk rectangle around each viewer is visited, never the whole field
+	TMap<FIntPoint, double> Wanted;
+	const int32 Reach = FMath::CeilToInt(LoadRadius / ChunkWorldSize);
+	for (const FVector2D& Viewer : Viewers)
+	{
+		const FIntPoint Center(FMath::FloorToInt(Viewer.X / ChunkWorldSize), FMath::FloorToInt(Viewer.Y / ChunkWorldSize));
+		for (int32 CY = FMath::Max(Center.Y - Reach, 0); CY <= FMath::Min(Center.Y + Reach, NumChunks.Y - 1); CY++)
+		{
+			for (int32 CX = FMath::Max(Center.X - Reach, 0); CX <= FMath::Min(Center.X + Reach, NumChunks.X - 1); CX++)
+			{
+				const FIntPoint Chunk(CX, CY);
+				if (LoadedChunks.Contains(Chunk))
+				{
+					continue;
+				}
+
+				const double DistanceSquared = GetDistanceSquared(Chunk, Viewer);
+				if (DistanceSquared <= FMath::Square(LoadRadius))
+				{
+					double& Nearest = Wanted.FindOrAdd(Chunk, DistanceSquared);
+					Nearest = FMath::Min(Nearest, DistanceSquared);
+				}
+			}
+		}
+	}
+
+	Wanted.ValueSort(TLess<double>());
+	int32 NumLoaded = 0;
+	for (const TPair<FIntPoint, double>& Pair : Wanted)
+	{
+		if (NumLoaded++ == MaxChunkLoadsPerUpdate)
+		{
+			break;
+		}
+		LoadChunk(Pair.Key);
+	}
+}
+
+bool AStreamedMinefieldActor::IsBomb(int32 X, int32 Y) const
+{
+	if (Game.SafeTile.X != INDEX_NONE && FMath::Abs(X - Game.SafeTile.X) <= 1 && FMath::Abs(Y - Game.SafeTile.Y) <= 1)
+	{
+		return false;
+	}
+	return StreamedMinefieldActor::HashTile(Game.Seed, X, Y) < Game.BombThreshold;
+}
+
+uint8 AStreamedMinefieldActor::GetTileCode(int32 X, int32 Y) const
+{
+	const TArray<uint8>* State = ChunkStates.Find(FIntPoint(X / ChunkSize, Y / ChunkSize));
+	if (!State)
+	{
+		return uint8(EMinefieldTileVisual::Hidden);
+	}
+
+	const int32 Index = (Y % ChunkSize) * ChunkSize + X % ChunkSize;
+	return ((*State)[Index >> 1] >> ((Index & 1) * 4)) & 0xf;
+}
+
+SIZE_T AStreamedMinefieldActor::GetStateSize() const
+{
+	SIZE_T Size = ChunkStates.GetAllocatedSize();
+	for (const TPair<FIntPoint, TArray<uint8>>& Pair : ChunkStates)
+	{
+		Size += Pair.Value.GetAllocatedSize();
+	}
+	return Size;
+}
+
+void AStreamedMinefieldActor::RebuildInstances()
+{
+	// The inherited single component stays empty, tiles only ever live in chunk components
+	GetTiles()->ClearInstances();
+
+	TArray<FIntPoint> Chunks;
+	LoadedChunks.GetKeys(Chunks);
+	for (const FIntPoint& Chunk : Chunks)
+	{
+		UnloadChunk(Chunk);
+	}
+
+	// Size or chunking may have changed, so reload only what still exists
+	const FIntPoint NumChunks = GetNumChunks();
+	for (const FIntPoint& Chunk : Chunks)
+	{
+		if (Chunk.X < NumChunks.X && Chunk.Y < NumChunks.Y)
+		{
+			LoadChunk(Chunk);
+		}
+	}
+}
+
+FIntPoint AStreamedMinefieldActor::GetNumChunks() const
+{
+	return FIntPoint(FMath::DivideAndRoundUp(Width, ChunkSize), FMath::DivideAndRoundUp(Height, ChunkSize));
+}
+
+FIntPoint AStreamedMinefieldActor::GetChunkExtent(const FIntPoint& Chunk) const
+{
+	return FIntPoint(FMath::Min(ChunkSize, Width - Chunk.X * ChunkSize), FMath::Min(ChunkSize, Height - Chunk.Y * ChunkSize));
+}
+
+int32 AStreamedMinefieldActor::CountAdjacentBombs(int32 X, int32 Y) const
+{
+	int32 Count = 0;
+	for (int32 NY = FMath::Max(Y - 1, 0); NY <= FMath::Min(Y + 1, Height - 1); NY++)
+	{
+		for (int32 NX = FMath::Max(X - 1, 0); NX <= FMath::Min(X + 1, Width - 1); NX++)
+		{
+			Count += (NX != X || NY != Y) && IsBomb(NX, NY) ? 1 : 0;
+		}
+	}
+	return Count;
+}
+
+uint8 AStreamedMinefieldActor::GetDisplayCode(int32 X, int32 Y) const
+{
+	const uint8 Code = GetTileCode(X, Y);
+	if (bLost && Code == uint8(EMinefieldTileVisual::Hidden) && IsBomb(X, Y))
+	{
+		return uint8(EMinefieldTileVisual::Bomb);
+	}
+	return Code;
+}
+
+void AStreamedMinefieldActor::SetTileCode(int32 X, int32 Y, uint8 Code)
+{
+	const FIntPoint Chunk(X / ChunkSize, Y / ChunkSize);
+
+	TArray<uint8>& State = ChunkStates.FindOrAdd(Chunk);
+	if (State.Num() == 0)
+	{
+		State.Init(StreamedMinefieldActor::HiddenPair, FMath::DivideAndRoundUp(ChunkSize * ChunkSize, 2));
+	}
+
+	const FIntPoint Local(X % ChunkSize, Y % ChunkSize);
+	const int32 Index = Local.Y * ChunkSize + Local.X;
+	const int32 Shift = (Index & 1) * 4;
+	State[Index >> 1] = uint8((State[Index >> 1] & ~(0xf << Shift)) | (Code << Shift));
+
+	if (Code == uint8(EMinefieldTileVisual::Exploded) && !bLost)
+	{
+		bLost = true;
+
+		// Only the loaded chunks uncover their bombs now, the others do when they stream in
+		for (const TPair<FIntPoint, UHierarchicalInstancedStaticMeshComponent*>& Pair : LoadedChunks)
+		{
+			const FIntPoint Origin = Pair.Key * ChunkSize;
+			const FIntPoint Extent = GetChunkExtent(Pair.Key);
+			for (int32 LY = 0; LY < Extent.Y; LY++)
+			{
+				for (int32 LX = 0; LX < Extent.X; LX++)
+				{
+					Pair.Value->SetCustomDataValue(LY * Extent.X + LX, 0, GetDisplayCode(Origin.X + LX, Origin.Y + LY), false);
+				}
+			}
+			DirtyChunks.Add(Pair.Key);
+		}
+	}
+
+	if (UHierarchicalInstancedStaticMeshComponent* const* Component = LoadedChunks.Find(Chunk))
+	{
+		(*Component)->SetCustomDataValue(Local.Y * GetChunkExtent(Chunk).X + Local.X, 0, Code, false);
+	}
+	DirtyChunks.Add(Chunk);
+}
+
+void AStreamedMinefieldActor::LoadChunk(const FIntPoint& Chunk)
+{
+	UHierarchicalInstancedStaticMeshComponent* Component = nullptr;
+	if (FreeChunks.Num() > 0)
+	{
+		Component = FreeChunks.Pop(EAllowShrinking::No);
+		Component->SetVisibility(true);
+	}
+	else
+	{
+		const UHierarchicalInstancedStaticMeshComponent* Template = GetTiles();
+		Component = NewObject<UHierarchicalInstancedStaticMeshComponent>(this);
+		Component->SetStaticMesh(Template->GetStaticMesh());
+		for (int32 Slot = 0; Slot < Template->GetNumMaterials(); Slot++)
+		{
+			Component->SetMaterial(Slot, Template->GetMaterial(Slot));
+		}
+		Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Component->SetCastShadow(false);
+		Component->SetNumCustomDataFloats(1);
+		Component->RegisterComponent();
+		Component->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
+	}
+
+	const FIntPoint Origin = Chunk * ChunkSize;
+	const FIntPoint Extent = GetChunkExtent(Chunk);
+	Component->SetRelativeLocation(FVector(Origin.X * TileSize, Origin.Y * TileSize, 0.0f));
+
+	TArray<FTransform> Transforms;
+	Transforms.Reserve(Extent.X * Extent.Y);
+	for (int32 LY = 0; LY < Extent.Y; LY++)
+	{
+		for (int32 LX = 0; LX < Extent.X; LX++)
+		{
+			Transforms.Add(GetTileTransform(LX, LY));
+		}
+	}
+	Component->AddInstances(Transforms, false);
+
+	for (int32 LY = 0; LY < Extent.Y; LY++)
+	{
+		for (int32 LX = 0; LX < Extent.X; LX++)
+		{
+			Component->SetCustomDataValue(LY * Extent.X + LX, 0, GetDisplayCode(Origin.X + LX, Origin.Y + LY), false);
+		}
+	}
+	Component->MarkRenderStateDirty();
+
+	LoadedChunks.Add(Chunk, Component);
+}
+
+void AStreamedMinefieldActor::UnloadChunk(const FIntPoint& Chunk)
+{
+	UHierarchicalInstancedStaticMeshComponent* Component = nullptr;
+	if (!LoadedChunks.RemoveAndCopyValue(Chunk, Component))
+	{
+		return;
+	}
+
+	// The packed state in ChunkStates is all that remains of the chunk
+	Component->ClearInstances();
+	Component->SetVisibility(false);
+	FreeChunks.Add(Component);
+}
+
+void AStreamedMinefieldActor::FlushDirtyChunks()
+{
+	const bool bReplicate = HasAuthority() && GetNetMode() != NM_Standalone;
+	for (const FIntPoint& Chunk : DirtyChunks)
+	{
+		if (UHierarchicalInstancedStaticMeshComponent* const* Component = LoadedChunks.Find(Chunk))
+		{
+			(*Component)->MarkRenderStateDirty();
+		}
+		if (bReplicate)
+		{
+			EncodeChunk(Chunk);
+		}
+	}
+	DirtyChunks.Reset();
+}
+
+void AStreamedMinefieldActor::EncodeChunk(const FIntPoint& Chunk)
+{
+	using namespace StreamedMinefieldActor;
+
+	const int32* ItemIndex = ChunkItemIndices.Find(Chunk);
+	if (!ItemIndex)
+	{
+		ItemIndex = &ChunkItemIndices.Add(Chunk, ChunkArray.Items.Num());
+		ChunkArray.Items.AddDefaulted_GetRef().Chunk = Chunk;
+	}
+
+	const FIntPoint Origin = Chunk * ChunkSize;
+	TArray<EMinefieldRunKind> TileKinds;
+	TileKinds.SetNumUninitialized(ChunkSize * ChunkSize);
+	for (int32 Tile = 0; Tile < TileKinds.Num(); Tile++)
+	{
+		TileKinds[Tile] = GetRunKind(GetTileCode(Origin.X + Tile % ChunkSize, Origin.Y + Tile / ChunkSize));
+	}
+
+	FMinefieldChunkItem& Item = ChunkArray.Items[*ItemIndex];
+	Item.EncodeRuns(TileKinds);
+	ChunkArray.MarkItemDirty(Item);
+}
+
+void AStreamedMinefieldActor::DecodeChunk(const FMinefieldChunkItem& Item)
+{
+	// Checked as a whole first, so a damaged item changes nothing rather than half a chunk
+	TArray<EMinefieldRunKind> TileKinds;
+	if (!Item.DecodeRuns(ChunkSize * ChunkSize, TileKinds))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StreamedMinefieldActor: Ignoring malformed state of chunk %d,%d"), Item.Chunk.X, Item.Chunk.Y);
+		return;
+	}
+
+	const FIntPoint Origin = Item.Chunk * ChunkSize;
+	for (int32 Tile = 0; Tile < TileKinds.Num(); Tile++)
+	{
+		const int32 X = Origin.X + Tile % ChunkSize;
+		const int32 Y = Origin.Y + Tile / ChunkSize;
+		if (X >= Width || Y >= Height)
+		{
+			continue;
+		}
+
+		uint8 Code = uint8(EMinefieldTileVisual::Hidden);
+		if (TileKinds[Tile] == EMinefieldRunKind::Flagged)
+		{
+			Code = uint8(EMinefieldTileVisual::Flagged);
+		}
+		else if (TileKinds[Tile] == EMinefieldRunKind::Revealed)
+		{
+			Code = IsBomb(X, Y) ? uint8(EMinefieldTileVisual::Exploded) : uint8(CountAdjacentBombs(X, Y));
+		}
+
+		if (GetTileCode(X, Y) != Code)
+		{
+			SetTileCode(X, Y, Code);
+		}
+	}
+}
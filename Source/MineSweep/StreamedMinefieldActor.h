@@ -0,0 +1,255 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MinefieldActor.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "StreamedMinefieldActor.generated.h"
+
+class AStreamedMinefieldActor;
+struct FMinefieldChunkArray;
+
+/** Everything a client needs besides chunk state to work out what each tile shows */
+USTRUCT()
+struct FStreamedMinefieldGame
+{
+	GENERATED_BODY()
+
+	/** Bumped by every new game, so clients notice a restart even with the same seed */
+	UPROPERTY()
+	int32 Round = 0;
+
+	UPROPERTY()
+	int32 Seed = 0;
+
+	/** Tiles whose hash is below this are bombs */
+	UPROPERTY()
+	uint32 BombThreshold = 0;
+
+	/** Tile revealed first, it and its neighbours are never bombs. INDEX_NONE until then */
+	UPROPERTY()
+	FIntPoint SafeTile = FIntPoint(INDEX_NONE);
+};
+
+/** What a tile is on the wire, everything else about it follows from the seed */
+enum class EMinefieldRunKind : uint8
+{
+	Hidden,
+	Revealed,
+	Flagged
+};
+
+/**
+ * Replicated state of one chunk. Only which tiles are revealed or flagged goes over
+ * the wire, run-length encoded; numbers and bombs follow from the seed on each client,
+ * so a flood fill opening thousands of tiles costs a few dozen bytes per chunk.
+ */
+USTRUCT()
+struct FMinefieldChunkItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FIntPoint Chunk = FIntPoint::ZeroValue;
+
+	/** Row-major runs over the whole chunk, each a varint of Length << 2 | Kind, see EMinefieldRunKind */
+	UPROPERTY()
+	TArray<uint8> Runs;
+
+	/** Rewrites Runs from the kind of every tile of the chunk, row-major */
+	void EncodeRuns(TConstArrayView<EMinefieldRunKind> TileKinds);
+
+	/**
+	 * Expands Runs into the kind of every tile. Returns false for runs that are truncated,
+	 * hold an unknown kind or do not cover exactly NumTiles, leaving OutTileKinds unspecified
+	 */
+	bool DecodeRuns(int32 NumTiles, TArray<EMinefieldRunKind>& OutTileKinds) const;
+
+	void PostReplicatedAdd(const FMinefieldChunkArray& InArraySerializer);
+	void PostReplicatedChange(const FMinefieldChunkArray& InArraySerializer);
+};
+
+USTRUCT()
+struct FMinefieldChunkArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FMinefieldChunkItem> Items;
+
+	/** Actor the array belongs to, told about every chunk received */
+	AStreamedMinefieldActor* Owner = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FMinefieldChunkItem, FMinefieldChunkArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FMinefieldChunkArray> : public TStructOpsTypeTraitsBase2<FMinefieldChunkArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+/**
+ * A minefield too large to lay out up front. Bombs are a hash of seed and tile,
+ * so nothing is generated before play, and the field is split into square chunks:
+ * only chunks near a player get an instanced mesh, every other chunk keeps at most
+ * its packed state, two tile codes per byte, and only once one of its tiles changed.
+ * Level load and memory therefore depend on how much of the field was visited, not
+ * on its size. Every machine streams chunks around its own local players, with the
+ * radii AMineSweepGameMode sets.
+ *
+ * In multiplayer the server owns the board: tiles change there only, and each
+ * changed chunk replicates as one fast array item, see FMinefieldChunkItem.
+ *
+ * Bomb placement is by density rather than an exact count, and the first tile
+ * revealed and its neighbours are always safe. There is no win state, the field
+ * is never scanned as a whole.
+ */
+UCLASS()
+class AStreamedMinefieldActor : public AMinefieldActor
+{
+	GENERATED_BODY()
+
+public:
+	AStreamedMinefieldActor();
+
+	/** Tiles per chunk side. Each loaded chunk is one instanced mesh component */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Streaming, meta = (ClampMin = "4", ClampMax = "128"))
+	int32 ChunkSize = 32;
+
+	/** Most chunks created per streaming update, so walking into a new area never spikes one frame */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Streaming, meta = (ClampMin = "1"))
+	int32 MaxChunkLoadsPerUpdate = 4;
+
+	/** Tiles across, used instead of Width, which is capped for fully generated boards */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield, meta = (ClampMin = "2", ClampMax = "1048576"))
+	int32 FieldWidth = 1024;
+
+	/** Tiles deep, used instead of Height */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield, meta = (ClampMin = "2", ClampMax = "1048576"))
+	int32 FieldHeight = 1024;
+
+	/**
+	 * Share of tiles holding a bomb, used instead of BombCount. Much below 0.1 the empty
+	 * tiles join up across the whole field and one reveal would open all of it
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield, meta = (ClampMin = "0.12", ClampMax = "0.9"))
+	float BombDensity = 0.15f;
+
+	/** Tiles a flood fill opens per tick on the server, a larger opening carries on over the next ticks */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Minefield, meta = (ClampMin = "1"))
+	int32 MaxRevealsPerTick = 4096;
+
+	/** Chunks closer than this to a local player get their instanced meshes. Set by the game mode */
+	UPROPERTY(Replicated, EditAnywhere, BlueprintReadOnly, Category = Streaming, meta = (ClampMin = "0.0"))
+	float LoadRadius = 6000.0f;
+
+	/** Loaded chunks are dropped past this distance */
+	UPROPERTY(Replicated, EditAnywhere, BlueprintReadOnly, Category = Streaming, meta = (ClampMin = "0.0"))
+	float UnloadRadius = 8000.0f;
+
+	/** Server only, clients follow through replication */
+	virtual void NewGame(int32 InSeed) override;
+	virtual bool RevealTile(int32 X, int32 Y) override;
+	virtual bool ToggleFlag(int32 X, int32 Y) override;
+
+	virtual void Tick(float DeltaSeconds) override;
+	virtual void PostNetReceive() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/**
+	 * Loads the chunks within LoadRadius of any viewer, nearest first, and drops the
+	 * ones further than UnloadRadius from all of them. Ticked with the local players.
+	 */
+	void UpdateStreaming(TConstArrayView<FVector> ViewerLocations);
+
+	bool IsBomb(int32 X, int32 Y) const;
+
+	/** What the tile shows, see EMinefieldTileVisual */
+	uint8 GetTileCode(int32 X, int32 Y) const;
+
+	bool IsLost() const { return bLost; }
+	int32 GetNumLoadedChunks() const { return LoadedChunks.Num(); }
+
+	/** Bytes held for chunk state, loaded or not */
+	SIZE_T GetStateSize() const;
+
+protected:
+	virtual void OnConstruction(const FTransform& Transform) override;
+	virtual void PostInitializeComponents() override;
+	virtual void RebuildInstances() override;
+
+private:
+	friend struct FMinefieldChunkItem;
+
+	FIntPoint GetNumChunks() const;
+
+	/** Tiles covered by a chunk, smaller than ChunkSize along the far edges of the field */
+	FIntPoint GetChunkExtent(const FIntPoint& Chunk) const;
+
+	int32 CountAdjacentBombs(int32 X, int32 Y) const;
+
+	/** Tile code shown by a loaded chunk, which also uncovers the bombs once the game is lost */
+	uint8 GetDisplayCode(int32 X, int32 Y) const;
+
+	void SetTileCode(int32 X, int32 Y, uint8 Code);
+
+	/** Opens pending flood fill tiles until the tick's budget runs out, then flushes what changed */
+	void ContinueReveal();
+
+	void LoadChunk(const FIntPoint& Chunk);
+	void UnloadChunk(const FIntPoint& Chunk);
+
+	/** Pushes the chunks changed since the last flush to the renderer and, on a server, to the clients */
+	void FlushDirtyChunks();
+
+	/** Rewrites the replicated item of a chunk from its packed state */
+	void EncodeChunk(const FIntPoint& Chunk);
+
+	/** Applies a received item to the packed state, working out the codes of revealed tiles locally */
+	void DecodeChunk(const FMinefieldChunkItem& Item);
+
+	/** Packed codes of every chunk with a changed tile, two per byte, low nibble first. Missing chunks are all hidden */
+	TMap<FIntPoint, TArray<uint8>> ChunkStates;
+
+	UPROPERTY(Replicated)
+	FStreamedMinefieldGame Game;
+
+	UPROPERTY(Replicated)
+	FMinefieldChunkArray ChunkArray;
+
+	/** Server side index of each chunk's item in ChunkArray */
+	TMap<FIntPoint, int32> ChunkItemIndices;
+
+	/** Client side, chunks received since the last PostNetReceive */
+	TSet<FIntPoint> ReceivedChunks;
+
+	/** Client side, the round the packed state belongs to */
+	int32 AppliedRound = 0;
+
+	bool bLost = false;
+
+	/** Server side flood fill frontier, carried over to the next tick once RevealBudget is spent */
+	TArray<FIntPoint> PendingReveals;
+
+	/** Tiles the flood fill may still open this tick, refilled from MaxRevealsPerTick */
+	int32 RevealBudget = 0;
+
+	/** Chunks near a viewer, each one instance per tile in row-major order */
+	UPROPERTY(Transient)
+	TMap<FIntPoint, UHierarchicalInstancedStaticMeshComponent*> LoadedChunks;
+
+	/** Unloaded chunk components kept for reuse, so streaming does not churn UObjects */
+	UPROPERTY(Transient)
+	TArray<UHierarchicalInstancedStaticMeshComponent*> FreeChunks;
+
+	/** Chunks with a tile changed since the last flush, loaded or not */
+	TSet<FIntPoint> DirtyChunks;
+};
@@ -0,0 +1,115 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "StreamedMinefieldActor.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace StreamedMinefieldActorTest
+{
+	using EKind = EMinefieldRunKind;
+
+	/** Tiles in a chunk of the default ChunkSize */
+	constexpr int32 NumTiles = 32 * 32;
+
+	void AddRun(TArray<EKind>& Tiles, EKind Kind, int32 Length)
+	{
+		for (int32 Index = 0; Index < Length; Index++)
+		{
+			Tiles.Add(Kind);
+		}
+	}
+
+	/** Encodes Tiles, checks they decode to the same kinds and returns the encoded size */
+	int32 TestRoundTrip(FAutomationTestBase& Test, const TCHAR* What, const TArray<EKind>& Tiles)
+	{
+		FMinefieldChunkItem Item;
+		Item.EncodeRuns(Tiles);
+
+		TArray<EKind> Decoded;
+		const bool bDecoded = Item.DecodeRuns(Tiles.Num(), Decoded);
+		Test.TestTrue(FString::Printf(TEXT("%s decodes"), What), bDecoded);
+		Test.TestTrue(FString::Printf(TEXT("%s decodes to the same tiles"), What), bDecoded && Decoded == Tiles);
+		return Item.Runs.Num();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamedMinefieldChunkRunsTest, "MineSweep.StreamedMinefield.ChunkRuns",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FStreamedMinefieldChunkRunsTest::RunTest(const FString& Parameters)
+{
+	using namespace StreamedMinefieldActorTest;
+
+	// A whole chunk in one state is a single run, 1024 << 2 needs a two byte varint
+	TArray<EKind> Tiles;
+	AddRun(Tiles, EKind::Hidden, NumTiles);
+	TestEqual(TEXT("All hidden is one two byte run"), TestRoundTrip(*this, TEXT("All hidden"), Tiles), 2);
+
+	Tiles.Reset();
+	AddRun(Tiles, EKind::Revealed, NumTiles);
+	TestEqual(TEXT("All revealed is one two byte run"), TestRoundTrip(*this, TEXT("All revealed"), Tiles), 2);
+
+	// Runs either side of the one byte limit of 31 tiles, and well past 127
+	Tiles.Reset();
+	AddRun(Tiles, EKind::Hidden, 200);
+	AddRun(Tiles, EKind::Revealed, 31);
+	AddRun(Tiles, EKind::Flagged, 32);
+	AddRun(Tiles, EKind::Revealed, 300);
+	AddRun(Tiles, EKind::Flagged, 1);
+	AddRun(Tiles, EKind::Hidden, NumTiles - Tiles.Num());
+	TestEqual(TEXT("Long runs take two bytes, short ones one"), TestRoundTrip(*this, TEXT("Long runs"), Tiles), 2 + 1 + 2 + 2 + 1 + 2);
+
+	// The worst case, every tile its own run
+	Tiles.Reset();
+	for (int32 Tile = 0; Tile < NumTiles; Tile++)
+	{
+		Tiles.Add(Tile % 2 ? EKind::Revealed : EKind::Flagged);
+	}
+	TestEqual(TEXT("Alternating tiles take a byte each"), TestRoundTrip(*this, TEXT("Alternating"), Tiles), NumTiles);
+
+	FRandomStream Random(7);
+	for (int32 Case = 0; Case < 16; Case++)
+	{
+		Tiles.Reset();
+		while (Tiles.Num() < NumTiles)
+		{
+			AddRun(Tiles, EKind(Random.RandRange(0, 2)), FMath::Min(Random.RandRange(1, 400), NumTiles - Tiles.Num()));
+		}
+		TestRoundTrip(*this, *FString::Printf(TEXT("Random runs %d"), Case), Tiles);
+	}
+
+	// Damaged items must be rejected as a whole, never read past the end of the buffer
+	Tiles.Reset();
+	AddRun(Tiles, EKind::Hidden, 200);
+	AddRun(Tiles, EKind::Revealed, NumTiles - 200);
+	FMinefieldChunkItem Item;
+	Item.EncodeRuns(Tiles);
+	const TArray<uint8> Encoded = Item.Runs;
+	TArray<EKind> Decoded;
+
+	Item.Runs.SetNum(Encoded.Num() - 1);
+	TestFalse(TEXT("A varint cut off after its first byte is rejected"), Item.DecodeRuns(NumTiles, Decoded));
+
+	Item.Runs.SetNum(Encoded.Num() - 2);
+	TestFalse(TEXT("A missing last run is rejected"), Item.DecodeRuns(NumTiles, Decoded));
+
+	Item.Runs.Reset();
+	TestFalse(TEXT("An empty item is rejected"), Item.DecodeRuns(NumTiles, Decoded));
+
+	Item.Runs = Encoded;
+	TestFalse(TEXT("Runs covering more than the chunk are rejected"), Item.DecodeRuns(NumTiles - 1, Decoded));
+	TestFalse(TEXT("Runs covering less than the chunk are rejected"), Item.DecodeRuns(NumTiles + 1, Decoded));
+
+	// 1024 tiles of kind 3
+	Item.Runs = { 0x83, 0x20 };
+	TestFalse(TEXT("An unknown kind is rejected"), Item.DecodeRuns(NumTiles, Decoded));
+
+	Item.Runs = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x01 };
+	TestFalse(TEXT("A varint longer than 32 bits is rejected"), Item.DecodeRuns(NumTiles, Decoded));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS